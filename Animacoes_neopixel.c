@@ -1,18 +1,36 @@
 #include <stdio.h>
+#include <string.h>
 #include "pico/stdlib.h"
-#include "ws2818b.pio.h"
+#include "neopixel.h"
+#include "neopixel_gamma.h"
+#include "efeitos.h"
+#include "neopixel_stream.h"
+#include "keypad.h"
+#include "prof.h"
+#include "neopixel_swar.h"
 #include "hardware/timer.h"
 #include "hardware/clocks.h"
 #include "hardware/pio.h"
 #include "pico/bootrom.h"
+#include "pico/multicore.h"
 
 // define o LED de saída
 #define GPIO_LED 13
 
-// Definição do número de LEDs e pino.
-#define LED_COUNT 25
+// Definição do pino da matriz.
 #define LED_PIN 7
 
+// Com 1, o núcleo 1 desenha e transmite (PIO/DMA) e o núcleo 0 cuida do teclado e do stdio;
+// com 0, tudo roda no núcleo 0 como antes.
+#ifndef NP_DUAL_CORE
+#define NP_DUAL_CORE 1
+#endif
+
+// Com 1, a matriz é reenviada continuamente com pontilhamento temporal (mais tons nos brilhos baixos).
+#ifndef NP_DITHER
+#define NP_DITHER 1
+#endif
+
 uint columns[4] = {16, 17, 18, 19}; // Pinos corretos para a BitDogLab
 uint rows[4] = {0, 1, 2, 3};
 
@@ -29,1067 +47,313 @@ char KEY_MAP[16] = {
 //     'C', '9', '8', '7',
 //     'B', '#', '0', '*'};
 
-// Definição de pixel GRB
-struct pixel_t
-{
-    uint8_t G, R, B; // Três valores de 8-bits compõem um pixel.
-};
-typedef struct pixel_t pixel_t;
-typedef pixel_t npLED_t; // Mudança de nome de "struct pixel_t" para "npLED_t" por clareza.
-
-// Declaração do buffer de pixels que formam a matriz.
-npLED_t leds[LED_COUNT];
-
-// Variáveis para uso da máquina PIO.
-PIO np_pio;
-uint sm;
-
-/**
- * Inicializa a máquina PIO para controle da matriz de LEDs.
- */
-void npInit(uint pin)
-{
+// Comandos para o laço de renderização (FIFO entre núcleos): tipo no byte 1, tecla no byte 0.
+#define CMD_START 0x100u  // Troca para o efeito da tecla.
+#define CMD_REPEAT 0x200u // Repete o efeito da tecla, se o anterior já terminou.
+#define CMD_BRIGHTNESS 0x300u // Novo nível de brilho global no byte 0.
+#define CMD_TEXT 0x400u       // Próximo caractere do texto do letreiro no byte 0.
+#define CMD_TEXT_END 0x500u   // Fim do texto: troca o letreiro e o inicia.
+#define CMD_STREAM 0x600u     // Quadros do host: para o efeito e cede o buffer de trás ao stdio.
+#define CMD_STREAM_FRAME 0x700u // Quadro do host completo no buffer de trás: apresenta.
 
-    // Cria programa PIO.
-    uint offset = pio_add_program(pio0, &ws2818b_program);
-    np_pio = pio0;
+static np_player_t player;
 
-    // Toma posse de uma máquina PIO.
-    sm = pio_claim_unused_sm(np_pio, false);
-    if (sm < 0)
-    {
-        np_pio = pio1;
-        sm = pio_claim_unused_sm(np_pio, true); // Se nenhuma máquina estiver livre, panic!
-    }
+// Quadros do host na tela: o buffer de trás tem o penúltimo (ou um pela metade).
+static bool stream_na_tela = false;
 
-    // Inicia programa na máquina PIO obtida.
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+// Texto do letreiro em recepção; o letreiro em andamento continua com o anterior.
+static char texto_novo[LETREIRO_MAX + 1];
+static uint texto_novo_len;
 
-    // Limpa buffer de pixels.
-    for (uint i = 0; i < LED_COUNT; ++i)
-    {
-        leds[i].R = 0;
-        leds[i].G = 0;
-        leds[i].B = 0;
-    }
-}
-
-/**
- * Atribui uma cor RGB a um LED.
- */
-void npSetLED(const uint index, const uint8_t r, const uint8_t g, const uint8_t b)
+static void render_init(void)
 {
-    leds[index].R = r;
-    leds[index].G = g;
-    leds[index].B = b;
-}
+    npInitMode(LED_PIN, NP_MODE_GRB24);
+    npClear();
 
-/**
- * Limpa o buffer de pixels.
- */
-void npClear()
-{
-    for (uint i = 0; i < LED_COUNT; ++i)
-        npSetLED(i, 0, 0, 0);
-}
+    // Aqui, você desenha nos LEDs.
 
-/**
- * Escreve os dados do buffer nos LEDs.
- */
-void npWrite()
-{
-    // Escreve cada dado de 8-bits dos pixels em sequência no buffer da máquina PIO.
-    for (uint i = 0; i < LED_COUNT; ++i)
-    {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
-    }
-    sleep_us(100); // Espera 100us, sinal de RESET do datasheet.
+    npWrite(); // Escreve os dados nos LEDs.
+    npSetDither(NP_DITHER);
 }
 
-uint _columns[4];
-uint _rows[4];
-char _matrix_values[16];
-uint all_columns_mask = 0x0;
-uint column_mask[4];
-
-// imprimir valor binário
-void imprimir_binario(int num)
+// Com dois núcleos, o núcleo 0 escreve os quadros do host no buffer de trás, que só pode
+// tocar depois que o núcleo 1 parou o efeito ou trocou os buffers: cada comando de stream
+// é confirmado pela FIFO no sentido contrário.
+static void stream_ack(void)
 {
-    int i;
-    for (i = 31; i >= 0; i--)
-    {
-        (num & (1 << i)) ? printf("1") : printf("0");
-    }
+#if NP_DUAL_CORE
+    multicore_fifo_push_blocking(0);
+#endif
 }
 
-// inicializa o keypad
-void pico_keypad_init(uint columns[4], uint rows[4], char matrix_values[16])
+// Fim dos quadros do host: os efeitos que desenham sobre o quadro anterior (coração,
+// letreiro) partem do que está nos LEDs, não do buffer de trás deixado pelo stream.
+static void stream_fim(void)
 {
-
-    for (int i = 0; i < 16; i++)
-    {
-        _matrix_values[i] = matrix_values[i];
-    }
-
-    for (int i = 0; i < 4; i++)
-    {
-
-        _columns[i] = columns[i];
-        _rows[i] = rows[i];
-
-        gpio_init(_columns[i]);
-        gpio_init(_rows[i]);
-
-        gpio_set_dir(_columns[i], GPIO_IN);
-        gpio_set_dir(_rows[i], GPIO_OUT);
-
-        gpio_put(_rows[i], 1);
-
-        all_columns_mask = all_columns_mask + (1 << _columns[i]);
-        column_mask[i] = 1 << _columns[i];
-    }
+    if (!stream_na_tela)
+        return;
+    stream_na_tela = false;
+    npCopyFront();
 }
 
-// coleta o caracter pressionado
-char pico_keypad_get_key(void)
+static void render_command(uint32_t cmd, uint64_t now)
 {
-    int row;
-    uint32_t cols;
-    bool pressed = false;
-
-    cols = gpio_get_all();
-    cols = cols & all_columns_mask;
-    imprimir_binario(cols);
-
-    if (cols == 0x0)
+    // Brilho: só troca a tabela; um quadro parado é reenviado, sem redesenhar.
+    if ((cmd & 0xff00u) == CMD_BRIGHTNESS)
     {
-        return 0;
+        npSetBrightness(cmd & 0xffu);
+        if (!player.step)
+            npRefresh();
+        return;
     }
 
-    for (int j = 0; j < 4; j++)
+    // Texto: caracteres além de LETREIRO_MAX são descartados.
+    if ((cmd & 0xff00u) == CMD_TEXT)
     {
-        gpio_put(_rows[j], 0);
+        if (texto_novo_len < LETREIRO_MAX)
+            texto_novo[texto_novo_len++] = (char)cmd;
+        return;
     }
-
-    for (row = 0; row < 4; row++)
+    if ((cmd & 0xff00u) == CMD_TEXT_END)
     {
-
-        gpio_put(_rows[row], 1);
-
-        busy_wait_us(10000);
-
-        cols = gpio_get_all();
-        gpio_put(_rows[row], 0);
-        cols = cols & all_columns_mask;
-        if (cols != 0x0)
-        {
-            break;
-        }
+        stream_fim();
+        memcpy(letreiro_texto, texto_novo, texto_novo_len);
+        letreiro_texto[texto_novo_len] = '\0';
+        texto_novo_len = 0;
+        iniciar_efeito(&player, '9', now);
+        return;
     }
 
-    for (int i = 0; i < 4; i++)
+    // Quadros do host: apresentados assim que completos, sem o governador.
+    if ((cmd & 0xff00u) == CMD_STREAM)
     {
-        gpio_put(_rows[i], 1);
+        npPlayerStop(&player);
+        stream_na_tela = true;
+        texto_novo_len = 0;
+        stream_ack();
+        return;
     }
-
-    if (cols == column_mask[0])
+    if ((cmd & 0xff00u) == CMD_STREAM_FRAME)
     {
-        return (char)_matrix_values[row * 4 + 0];
+        npPresent();
+        stream_ack();
+        return;
     }
-    else if (cols == column_mask[1])
-    {
-        return (char)_matrix_values[row * 4 + 1];
-    }
-    if (cols == column_mask[2])
-    {
-        return (char)_matrix_values[row * 4 + 2];
-    }
-    else if (cols == column_mask[3])
-    {
-        return (char)_matrix_values[row * 4 + 3];
-    }
-    else
+
+    // Nova tecla: troca o efeito na próxima fronteira de quadro.
+    // Tecla mantida: repete o efeito se o anterior já terminou, como antes.
+    if ((cmd & 0xff00u) == CMD_START || !player.step)
     {
-        return 0;
+        stream_fim();
+        iniciar_efeito(&player, (char)cmd, now);
     }
 }
 
-// Mapeamento da matriz (5x5)
-int getIndex(int x, int y)
+// Desenha o próximo quadro, se o anterior já foi apresentado, e retorna quando o laço deve
+// acordar de novo. A apresentação vem do alarme do governador, que também acorda o laço.
+static uint64_t render_poll(uint64_t now)
 {
-    return (y % 2 == 0) ? y * 5 + x : y * 5 + (4 - x);
+    if (player.step)
+        npPlayerRun(&player, now);
+    return player.step ? player.deadline : now + 1000000;
 }
 
-// Animação do coração
-void heartAnimation()
+#if NP_DUAL_CORE
+// Núcleo 1: dono da PIO, do DMA e das animações; só recebe comandos pela FIFO.
+static void core1_main(void)
 {
+    prof_init();
+    render_init();
 
-    int corazon[][2] = {
-        {2, 0}, // Base do coração
-        {1, 1},
-        {3, 1}, // Meio inferior
-        {0, 2},
-        {4, 2}, // Laterais
-        {0, 3},
-        {2, 3},
-        {4, 3}, // Meio superior
-        {1, 4},
-        {3, 4} // Topo
-    };
-
-    // Coração aparecendo
-    for (int i = 0; i < 10; i++)
-    {
-        int idx = getIndex(corazon[i][0], corazon[i][1]);
-        npSetLED(idx, 10, 0, 0); // Cor vermelha
-        npWrite();
-        sleep_ms(100);
-    }
-
-    sleep_ms(500); // Mantém o coração aceso por um tempo
-
-    // Apaga o coração gradualmente
-    for (int i = 9; i >= 0; i--)
+    while (true)
     {
-        int idx = getIndex(corazon[i][0], corazon[i][1]);
-        npSetLED(idx, 0, 0, 0);
-        npWrite();
-        sleep_ms(100);
+        PROF_BEGIN(PROF_LOOP_RENDER);
+        uint64_t now = time_us_64();
+        while (multicore_fifo_rvalid())
+            render_command(multicore_fifo_pop_blocking(), now);
+        uint64_t proximo = render_poll(now);
+        PROF_END(PROF_LOOP_RENDER);
+
+        // Um push na FIFO (SEV) ou a interrupção do quadro acordam o núcleo.
+        best_effort_wfe_or_timeout(from_us_since_boot(proximo));
     }
 }
+#endif
 
-// Animação de fogo
-void foguinho()
+static void send_command(uint32_t cmd, uint64_t now)
 {
-    npSetLED(4, 50, 0, 0);
-    npSetLED(6, 50, 0, 0);
-    npSetLED(12, 50, 0, 0);
-    npSetLED(8, 50, 0, 0);
-    npSetLED(0, 50, 0, 0);
-    npSetLED(3, 50, 50, 0);
-    npSetLED(7, 50, 50, 0);
-    npSetLED(1, 50, 50, 0);
-    npSetLED(2, 50, 50, 50);
-
-    npWrite();
-    sleep_ms(100);
-
-    npSetLED(9, 50, 0, 0);
-    npSetLED(11, 50, 0, 0);
-    npSetLED(18, 50, 0, 0);
-
-    npWrite();
-    sleep_ms(100);
-
-    npSetLED(8, 50, 50, 50);
-    npSetLED(11, 50, 50, 0);
-    npSetLED(10, 50, 0, 0);
-    npSetLED(15, 50, 0, 0);
-    npSetLED(22, 50, 0, 0);
-    npSetLED(21, 50, 0, 0);
-
-    npWrite();
-    sleep_ms(100);
-
-    npSetLED(9, 0, 0, 0);
-    npSetLED(10, 0, 0, 0);
-    npSetLED(21, 0, 0, 0);
-    npSetLED(15, 0, 0, 0);
-    npSetLED(14, 50, 0, 0);
-    npSetLED(5, 50, 0, 0);
-    npSetLED(4, 50, 50, 0);
-    npSetLED(6, 50, 50, 0);
-    npSetLED(12, 50, 50, 0);
-    npSetLED(2, 50, 50, 50);
-    npSetLED(5, 50, 0, 0);
-    npSetLED(13, 50, 0, 0);
-    npSetLED(17, 50, 0, 0);
-    npSetLED(3, 50, 50, 50);
-    npSetLED(7, 50, 50, 50);
-    npSetLED(11, 50, 0, 0);
-    npSetLED(18, 50, 0, 0);
-    npSetLED(8, 50, 0, 0);
-    npSetLED(16, 50, 0, 0);
-
-    npWrite();
-    sleep_ms(100);
-
-    npSetLED(4, 50, 0, 0);
-    npSetLED(6, 50, 0, 0);
-    npSetLED(12, 50, 0, 0);
-    npSetLED(23, 50, 0, 0);
-    npSetLED(15, 50, 0, 0);
-    npSetLED(3, 50, 50, 0);
-    npSetLED(7, 50, 50, 0);
-    npSetLED(5, 0, 0, 0);
-    npSetLED(13, 0, 0, 0);
-    npSetLED(17, 0, 0, 0);
-    npSetLED(16, 0, 0, 0);
-    npSetLED(22, 0, 0, 0);
-
-    npWrite();
-    sleep_ms(100);
-
-    npSetLED(18, 0, 0, 0);
-    npSetLED(11, 0, 0, 0);
-    npSetLED(19, 0, 0, 0);
-    npSetLED(1, 50, 0, 0);
-    npSetLED(7, 50, 0, 0);
-    npSetLED(2, 50, 50, 0);
-    npSetLED(6, 50, 50, 0);
-    npSetLED(4, 50, 50, 0);
-    npSetLED(3, 50, 50, 50);
-    npSetLED(5, 50, 0, 0);
-    npSetLED(23, 0, 0, 0);
-    npSetLED(14, 0, 0, 0);
-
-    npWrite();
-    sleep_ms(100);
-    npClear();
+#if NP_DUAL_CORE
+    (void)now;
+    multicore_fifo_push_blocking(cmd);
+#else
+    render_command(cmd, now);
+#endif
 }
 
-#define ORANGE_R 10
-#define ORANGE_G 5
-#define ORANGE_B 0
-
-#define BLUE_R 0
-#define BLUE_G 0
-#define BLUE_B 10
-
-#define YELLOW_R 10
-#define YELLOW_G 10
-#define YELLOW_B 0
+// Recepção de quadros do host (ver neopixel_stream.h), no núcleo do stdio.
+static np_stream_t stream;
+static bool streaming = false;
+static uint stream_pending = 0; // Comandos de stream ainda sem confirmação.
 
-#define CYAN_R 0
-#define CYAN_G 10
-#define CYAN_B 10
-
-void tetrix()
+static void stream_command(uint32_t cmd, uint64_t now)
 {
-    // Frame 1
-    npClear(); // limpa todos os LEDs do frame anterior
-    // orange (25, 24)
-    npSetLED(25 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(24 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // (blue / yellow / cyan1 / cyan2 não têm LEDs neste frame)
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 2
-    npClear();
-    // orange (25, 16, 17)
-    npSetLED(25 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(16 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(17 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 3
-    npClear();
-    // orange (25, 16, 15, 14)
-    npSetLED(25 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(16 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(14 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 4
-    npClear();
-    // orange (16, 15, 6, 7)
-    npSetLED(16 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(7 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 5
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 6
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (23, 22)
-    npSetLED(23 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(22 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 7
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (22, 18, 19)
-    npSetLED(22 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(18 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(19 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 8
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (22, 19, 13, 12)
-    npSetLED(22 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(19 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(13 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 9
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (19, 12, 8, 9)
-    npSetLED(19 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(8 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 10
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 11
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 12
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (24, 23)
-    npSetLED(24 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(23 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 13
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (24, 23, 17, 18)
-    npSetLED(24 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(23 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(17 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(18 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 14
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (17, 18, 14, 13)
-    npSetLED(17 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(18 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 15
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 16
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (25, 24, 23, 22)
-    npSetLED(25 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(24 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(23 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(22 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 17
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 18
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (21)
-    npSetLED(21 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 19
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (21, 20)
-    npSetLED(21 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 20
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (21, 20, 11)
-    npSetLED(21 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(11 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 21
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (21, 20, 11, 10)
-    npSetLED(21 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(11 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(10 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(400);
-
-    // Frame 22
-    npClear();
-    // orange (15, 6, 5, 4)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(5 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(4 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9, 3, 2)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(3 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(2 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (20, 11, 10, 1)
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(11 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(10 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(1 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(100);
-
-    // Frame 23
-    npClear();
-    // orange (15, 6)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    npSetLED(6 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12, 9)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    npSetLED(9 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13, 7, 8)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(7 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(8 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (20, 11, 10)
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(11 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(10 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(100);
-
-    // Frame 24
-    npClear();
-    // orange (15)
-    npSetLED(15 - 1, ORANGE_R, ORANGE_G, ORANGE_B);
-    // blue (12)
-    npSetLED(12 - 1, BLUE_R, BLUE_G, BLUE_B);
-    // yellow (14, 13)
-    npSetLED(14 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    npSetLED(13 - 1, YELLOW_R, YELLOW_G, YELLOW_B);
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (20, 11)
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(11 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(100);
+    send_command(cmd, now);
+#if NP_DUAL_CORE
+    stream_pending++;
+#endif
+}
 
-    // Frame 25
-    npClear();
-    // orange: (nenhum)
-    // blue: (nenhum)
-    // yellow: (nenhum)
-    // cyan1 (16, 17, 18, 19)
-    npSetLED(16 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(17 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(18 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npSetLED(19 - 1, CYAN_R, CYAN_G, CYAN_B);
-    // cyan2 (20)
-    npSetLED(20 - 1, CYAN_R, CYAN_G, CYAN_B);
-    npWrite();
-    sleep_ms(100);
+// Espera o buffer de trás ficar livre para o próximo quadro do host.
+static void stream_sync(void)
+{
+    while (stream_pending)
+    {
+        multicore_fifo_pop_blocking();
+        stream_pending--;
+    }
+}
 
-    // Frame 26
-    npClear();
-    // orange: (nenhum)
-    // blue: (nenhum)
-    // yellow: (nenhum)
-    // cyan1: (nenhum)
-    // cyan2: (nenhum)
-    // aqui, todos desligados ou você pode remover o npClear() se quiser manter algo aceso
-    npWrite();
-    sleep_ms(400);
+// Uma tecla ou um texto devolvem a tela aos efeitos; um quadro pela metade é descartado.
+static void stream_stop(void)
+{
+    streaming = false;
+    npStreamInit(&stream);
 }
-void animacao_loading(){
-    npSetLED(0, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(1, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(2, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(3, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(4, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(5, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(14, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(15, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(24, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(23, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(22, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(21, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(20, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(19, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(10, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(9, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(8, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(7, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(6, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(13, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(16, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(17, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(18, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(11, 50, 0, 0);
-    npWrite();
-    sleep_ms(100);
-    npSetLED(12, 50, 0, 0);
-    npWrite();
-    sleep_ms(200);
-    npClear();
-    npWrite();
 
-    };
+// Texto comum no stdio: uma linha vira o texto do letreiro; linhas vazias (CR LF) são ignoradas.
+static uint texto_len = 0;
 
-// Animação de hélice enquanto pressiona botão 3
-void propeller(uint8_t flip){
-    if(flip % 2 == 0){
-        npSetLED(22, 0, 255, 0);
-        npSetLED(17, 255, 0, 0);
-        npSetLED(12, 0, 255, 0);
-        npSetLED(7, 255, 0, 0);
-        npSetLED(2, 0, 255, 0);
-        npSetLED(14, 0, 255, 0);
-        npSetLED(13, 255, 0, 0);
-        npSetLED(11, 0, 255, 0);
-        npSetLED(10, 255, 0, 0);
-    } else {
-        npSetLED(24, 0, 255, 0);
-        npSetLED(16, 255, 0, 0);
-        npSetLED(12, 0, 255, 0);
-        npSetLED(8, 255, 0, 0);
-        npSetLED(0, 0, 255, 0);
-        npSetLED(4, 0, 255, 0);
-        npSetLED(6, 255, 0, 0);
-        npSetLED(18, 255, 0, 0);
-        npSetLED(20, 0, 255, 0);
+static void texto_put(int c, uint64_t now)
+{
+    if (c == '\r' || c == '\n')
+    {
+        if (texto_len)
+        {
+            stream_stop();
+            send_command(CMD_TEXT_END, now);
+        }
+        texto_len = 0;
+    }
+    else if (c >= ' ' && c < 0x7f)
+    {
+        texto_len++;
+        send_command(CMD_TEXT | (uint8_t)c, now);
     }
-    npWrite();
-    
-}
-void letreiro(){
-    npSetLED(0, 50, 50, 50); 
-    npWrite();
-    sleep_ms(200);
-    npSetLED(1, 50, 0, 0);
-    npWrite();
-    sleep_ms(200);
-    npSetLED(2, 50, 50, 50);
-    npWrite();
-    sleep_ms(200);
-    npSetLED(3, 50, 0, 0);
-    npWrite();
-    sleep_ms(200);
-    npSetLED(4, 50, 50, 50); 
-    npWrite();
-    sleep_ms(200);
-    npClear();
 }
+
 // função principal
 int main()
 {
-    uint8_t flipflop = 1;
-    npInit(LED_PIN);
-    npClear();
-
-    // Aqui, você desenha nos LEDs.
+    stdio_init_all();
+    prof_init();
 
-    npWrite(); // Escreve os dados nos LEDs.
+#if NP_DUAL_CORE
+    multicore_launch_core1(core1_main);
+#else
+    render_init();
+#endif
 
-    stdio_init_all();
     pico_keypad_init(columns, rows, KEY_MAP); //Foi desabilitado pois estava impedindo o funcionamento dos leds da forma correta
     char caracter_press;
     gpio_init(GPIO_LED);
     gpio_set_dir(GPIO_LED, GPIO_OUT);
 
+    key_event_t ev;
+    uint brilho = NP_BRIGHTNESS_DEFAULT;
+    npStreamInit(&stream);
+
+    // Laço cooperativo: o teclado chega por eventos da interrupção; printf pode bloquear
+    // (stdio USB), o que só atrasa os quadros quando a renderização roda neste núcleo.
     while (true)
     {
-        caracter_press = pico_keypad_get_key(); //Foi comentado pois a tecla sempre estava vindo como tecla A, infinitamente
-        // caracter_press = '6'; // Tecla 6 foi definida fixa para testar os leds e animação
-        printf("\nTecla pressionada: %c\n", caracter_press);
+        PROF_BEGIN(PROF_LOOP_INPUT);
+        uint64_t now = time_us_64();
 
-        // Avaliação de caractere para o LED
-        if (caracter_press == 'B')
-        {
-            for (uint i = 0; i < LED_COUNT; i++)
-            {
-                npSetLED(i, 0, 0, 255);
-                sleep_us(200);
-                npWrite();
-            }
-        }
-        if (caracter_press == 'C')
+        while (pico_keypad_get_event(&ev))
         {
-            for (uint i = 0; i < LED_COUNT; i++)
-            {
-                npSetLED(i, 255*0.8, 0, 0);
-                sleep_us(200);
-                npWrite();
-            }
-        }
-        if (caracter_press == 'D')
-        {
-            for (uint i = 0; i < LED_COUNT; i++)
-            {
-                npSetLED(i, 0, 255*0.5, 0);
-                sleep_us(200);
-                npWrite();
-            }
-        }
-        if (caracter_press == '#')
-        {
-            for (uint i = 0; i < LED_COUNT; i++)
+            caracter_press = ev.key;
+
+            if (ev.type == KEY_PRESS)
             {
-                npSetLED(i, 255*0.2, 255*0.2, 255*0.2);
-                sleep_us(200);
-                npWrite();
+                printf("\nTecla pressionada: %c\n", caracter_press);
+
+                if (caracter_press == '*')
+                {
+                    rom_reset_usb_boot(0, 0);
+                }
+
+                // Tecla 0: prazos do governador de quadros desde o início e bytes que não
+                // precisaram ir para a linha.
+                if (caracter_press == '0')
+                {
+                    np_governor_stats_t gov;
+                    npGovernorStats(&gov);
+                    printf("Quadros: %u, prazos perdidos: %u, jitter medio: %u us, maximo: %u us\n",
+                           (unsigned)gov.frames, (unsigned)gov.missed,
+                           (unsigned)(gov.frames ? gov.jitter_sum_us / gov.frames : 0), (unsigned)gov.jitter_max_us);
+                    printf("Bytes economizados: %u\n", (unsigned)npGetSavedBytes());
+                }
+
+                // Tecla 8: histogramas da instrumentação (NP_PROF=1), zerados em seguida, e
+                // ciclos das operações SWAR contra o laço byte a byte.
+                if (caracter_press == '8')
+                {
+                    prof_dump();
+                    prof_reset();
+                    npSwarBenchDump();
+                }
+
+                stream_stop();
+                send_command(CMD_START | (uint8_t)caracter_press, now);
             }
-        }
+            else if (ev.type == KEY_REPEAT && !streaming)
+                send_command(CMD_REPEAT | (uint8_t)caracter_press, now);
 
-        if (caracter_press == 'A')
-        {
-            npClear();
-            npWrite();
-        }
-
-        if (caracter_press == '*')
-        {
-            rom_reset_usb_boot(0, 0);
-        }
-
-        if (caracter_press == '2')
-        {
-
-            heartAnimation();
-        }
-
-        if (caracter_press == '5')
-        {
-
-            uint seconds = 0;
-            while (seconds != 8)
+            // Teclas 1 e 4: diminuem e aumentam o brilho (mantidas, repetem).
+            if (ev.type != KEY_RELEASE && (caracter_press == '1' || caracter_press == '4'))
             {
-                foguinho();
-                seconds++;
+                if (caracter_press == '1' && brilho > 0)
+                    brilho--;
+                else if (caracter_press == '4' && brilho < NP_BRIGHTNESS_LEVELS - 1)
+                    brilho++;
+                send_command(CMD_BRIGHTNESS | brilho, now);
             }
         }
 
-        if (caracter_press == '7'){
-
-            animacao_loading();
-        }
-
-        if (caracter_press == '3'){
-            npClear();
-
-            propeller(flipflop);
-            npWrite();
-
-            flipflop++;
-        }
-
-
-        if (caracter_press == '6')
+        // stdio: quadros do host, escritos direto no buffer de trás, ou linhas de texto.
+        int c;
+        while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT)
         {
-            tetrix();
-        }
-
-        if (caracter_press == '9') 
-        {
-            
-            uint s = 0;
-            while (s != 3)
+            switch (npStreamPut(&stream, c, time_us_64()))
             {
-                letreiro();
-                s++;
+            case NP_STREAM_START:
+                if (!streaming)
+                {
+                    streaming = true;
+                    texto_len = 0;
+                    stream_command(CMD_STREAM, now);
+                }
+                stream_sync();
+                break;
+            case NP_STREAM_FRAME:
+                stream_command(CMD_STREAM_FRAME, now);
+                break;
+            case NP_STREAM_TEXT:
+                for (uint i = 0; i < stream.text_len; i++)
+                    texto_put(stream.header[i], now);
+                break;
+            default:
+                break;
             }
         }
-        busy_wait_us(500000);
+
+#if NP_DUAL_CORE
+        // Só as interrupções (teclado e stdio) trazem trabalho para este núcleo.
+        uint64_t proximo = now + 1000000;
+#else
+        uint64_t proximo = render_poll(now);
+#endif
+        PROF_END(PROF_LOOP_INPUT);
+        best_effort_wfe_or_timeout(from_us_since_boot(proximo));
     }
 }
@@ -0,0 +1,282 @@
+#include <string.h>
+#include "efeitos.h"
+#include "neopixel_asset.h"
+#include "np_assets.h"
+#include "neopixel_text.h"
+
+// Os efeitos desenham em torno do canto inferior esquerdo (ou do centro) de uma tela de pelo menos 5x5.
+_Static_assert(NP_WIDTH >= 5 && NP_HEIGHT >= 5, "efeitos precisam de uma tela de pelo menos 5x5");
+
+// Contorno do coração, de baixo para cima
+static const int corazon[][2] = {
+    {2, 0}, // Base do coração
+    {1, 1},
+    {3, 1}, // Meio inferior
+    {0, 2},
+    {4, 2}, // Laterais
+    {0, 3},
+    {2, 3},
+    {4, 3}, // Meio superior
+    {1, 4},
+    {3, 4} // Topo
+};
+
+// Animação do coração: 10 passos acendendo, 10 apagando, a 10 quadros por segundo
+uint32_t heartAnimation(np_player_t *p)
+{
+    if (p->frame == 20)
+        return NP_STEP_DONE;
+
+    if (p->frame < 10)
+    {
+        // Coração aparecendo
+        int i = p->frame;
+        npSetLED(npXY(corazon[i][0], corazon[i][1]), 255, 0, 0); // Cor vermelha
+    }
+    else
+    {
+        // Apaga o coração gradualmente
+        int i = 19 - p->frame;
+        npSetLED(npXY(corazon[i][0], corazon[i][1]), 0, 0, 0);
+    }
+
+    // Mantém o coração aceso por um tempo antes de apagar
+    return p->frame++ == 9 ? 6 : 1;
+}
+
+// Varredura: acende a tela ponto a ponto, linha a linha, na cor em p->arg (0xRRGGBB),
+// um ponto por quadro
+uint32_t varredura(np_player_t *p)
+{
+    uint i = p->frame++;
+    if (i == NP_WIDTH * NP_HEIGHT)
+        return NP_STEP_DONE;
+
+    // np_xy é contígua: o i-ésimo ponto da tela, sem dividir i pela largura.
+    npSetLED((&np_xy[0][0])[i], p->arg >> 16, p->arg >> 8, p->arg);
+    return 1;
+}
+
+// Pás da hélice em volta do centro da tela: deslocamento e cor (verde ou vermelho)
+typedef struct
+{
+    int8_t dx, dy;
+    bool red;
+} pa_t;
+
+static const pa_t helice_cruz[] = {
+    {0, 2, false}, {0, 1, true}, {0, 0, false}, {0, -1, true}, {0, -2, false},
+    {2, 0, false}, {1, 0, true}, {-1, 0, false}, {-2, 0, true},
+};
+
+static const pa_t helice_x[] = {
+    {2, 2, false}, {1, 1, true}, {0, 0, false}, {-1, -1, true}, {-2, -2, false},
+    {2, -2, false}, {1, -1, true}, {-1, 1, true}, {-2, 2, false},
+};
+
+// Animação de hélice enquanto pressiona botão 3
+void propeller(uint8_t flip){
+    const pa_t *pas = flip % 2 == 0 ? helice_cruz : helice_x;
+    for (uint i = 0; i < 9; i++)
+    {
+        uint x = NP_WIDTH / 2 + pas[i].dx, y = NP_HEIGHT / 2 + pas[i].dy;
+        npSetLED(npXY(x, y), pas[i].red ? 255 : 0, pas[i].red ? 0 : 255, 0);
+    }
+}
+
+// Um quadro da hélice por acionamento da tecla 3, alternando as pás
+uint32_t propeller_step(np_player_t *p)
+{
+    static uint8_t flipflop = 1;
+
+    if (p->frame++)
+        return NP_STEP_DONE;
+
+    npClear();
+    propeller(flipflop);
+    flipflop++;
+    return 1;
+}
+
+// Fogo: calor por ponto da tela (0..255), só com inteiros. A cada quadro, cada ponto esfria
+// um pouco ao acaso, o calor sobe misturando as duas linhas de baixo, a linha da base recebe
+// faíscas ao acaso e a paleta converte calor em cor. O trabalho por quadro é o mesmo sempre:
+// um punhado de somas e deslocamentos por ponto, sem divisões nem desvios que dependam do calor.
+#define FOGO_FPS 30
+#define FOGO_QUADROS 150 // ~5 s por acionamento da tecla.
+#define FOGO_FAISCA 120  // Chance (em 256) de faísca em cada ponto da base por quadro.
+
+// Esfriamento máximo por quadro: telas mais altas esfriam menos por linha, para a chama
+// ocupar a mesma fração da altura.
+#define FOGO_ESFRIAMENTO(altura) (640 / (altura) + 16)
+
+// Paleta de preto a vermelho, amarelo e branco, em terços, calculada na compilação (fica na flash).
+#define FOGO_T(h) ((h) * 191 / 255)
+#define FOGO_RAMPA(h) ((FOGO_T(h) & 0x3f) << 2)
+#define FOGO_COR(h) (FOGO_T(h) >= 0x80   ? NP_COLOR(255, 255, FOGO_RAMPA(h)) \
+                     : FOGO_T(h) >= 0x40 ? NP_COLOR(255, FOGO_RAMPA(h), 0)   \
+                                         : NP_COLOR(FOGO_RAMPA(h), 0, 0))
+#define FOGO_COR4(h) FOGO_COR(h), FOGO_COR((h) + 1), FOGO_COR((h) + 2), FOGO_COR((h) + 3)
+#define FOGO_COR16(h) FOGO_COR4(h), FOGO_COR4((h) + 4), FOGO_COR4((h) + 8), FOGO_COR4((h) + 12)
+#define FOGO_COR64(h) FOGO_COR16(h), FOGO_COR16((h) + 16), FOGO_COR16((h) + 32), FOGO_COR16((h) + 48)
+
+const npColor_t fogo_paleta[256] = {FOGO_COR64(0), FOGO_COR64(64), FOGO_COR64(128), FOGO_COR64(192)};
+
+static uint8_t calor[NP_HEIGHT][NP_WIDTH];
+static uint32_t fogo_semente = 0x9e3779b9u;
+
+// Gerador xorshift32: quatro bytes aleatórios por chamada.
+static inline uint32_t fogo_aleatorio(void)
+{
+    uint32_t x = fogo_semente;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return fogo_semente = x;
+}
+
+/**
+ * Apaga o fogo.
+ */
+void foguinho_iniciar(void)
+{
+    memset(calor, 0, sizeof(calor));
+}
+
+/**
+ * Avança um quadro a simulação sobre "mapa", o calor de largura x altura pontos (linha a
+ * linha, de baixo para cima), sem desenhar.
+ */
+void foguinho_simular(uint8_t *mapa, uint largura, uint altura)
+{
+    uint esfriamento = FOGO_ESFRIAMENTO(altura);
+    uint32_t r = 0;
+
+    // Esfriamento: um byte aleatório por ponto, escalado para 0..esfriamento-1.
+    for (uint y = 0; y < altura; y++)
+    {
+        uint8_t *linha = mapa + y * largura;
+        for (uint x = 0; x < largura; x++)
+        {
+            if ((x & 3) == 0)
+                r = fogo_aleatorio();
+            int h = linha[x] - (int)(((r & 0xff) * esfriamento) >> 8);
+            linha[x] = h > 0 ? h : 0;
+            r >>= 8;
+        }
+    }
+
+    // Subida: de cima para baixo, cada ponto recebe a média ponderada (pesos 1, 2, 1 na
+    // linha de baixo e 4 na de duas abaixo), de modo que as origens ainda são do quadro anterior.
+    for (uint y = altura - 1; y >= 1; y--)
+    {
+        uint8_t *linha = mapa + y * largura;
+        const uint8_t *b1 = linha - largura, *b2 = y >= 2 ? b1 - largura : b1;
+        for (uint x = 0; x < largura; x++)
+        {
+            uint xl = x ? x - 1 : x, xr = x + 1 < largura ? x + 1 : x;
+            linha[x] = (b1[xl] + 2 * b1[x] + b1[xr] + 4 * b2[x]) >> 3;
+        }
+    }
+
+    // Faíscas na base: calor entre 160 e 255, somado com saturação.
+    for (uint x = 0; x < largura; x++)
+    {
+        r = fogo_aleatorio();
+        if ((r & 0xff) < FOGO_FAISCA)
+        {
+            uint h = mapa[x] + 160 + ((r >> 8) & 0x5f);
+            mapa[x] = h < 255 ? h : 255;
+        }
+    }
+}
+
+/**
+ * Avança a simulação um quadro e desenha o resultado no buffer de trás.
+ */
+void foguinho_quadro(void)
+{
+    foguinho_simular(&calor[0][0], NP_WIDTH, NP_HEIGHT);
+
+    for (uint y = 0; y < NP_HEIGHT; y++)
+    {
+        const np_index_t *row = np_xy[y];
+        for (uint x = 0; x < NP_WIDTH; x++)
+            leds[row[x]] = fogo_paleta[calor[y][x]];
+    }
+}
+
+// Fogo por FOGO_QUADROS quadros, seguidos de um quadro apagado
+uint32_t foguinho(np_player_t *p)
+{
+    if (p->frame > FOGO_QUADROS)
+        return NP_STEP_DONE;
+    if (p->frame++ == FOGO_QUADROS)
+    {
+        npClear();
+        return 1;
+    }
+    if (p->frame == 1)
+        foguinho_iniciar();
+
+    foguinho_quadro();
+    return 1;
+}
+
+// Apaga a matriz
+uint32_t apagar(np_player_t *p)
+{
+    if (p->frame++)
+        return NP_STEP_DONE;
+    npClear();
+    return 1;
+}
+
+char letreiro_texto[LETREIRO_MAX + 1] = "EMBARCATECH";
+
+#define RGB(r, g, b) ((uint32_t)(r) << 16 | (uint32_t)(g) << 8 | (uint32_t)(b))
+
+const efeito_t efeitos[] = {
+    {.key = 'A', .name = "apagar", .step = apagar, .fps = 10, .repeat = 1},
+    {.key = 'B', .name = "varredura_azul", .step = varredura, .arg = RGB(0, 0, 255), .fps = 1000, .repeat = 1},
+    {.key = 'C', .name = "varredura_vermelha", .step = varredura, .arg = RGB(255, 0, 0), .fps = 1000, .repeat = 1},
+    {.key = 'D', .name = "varredura_verde", .step = varredura, .arg = RGB(0, 255, 0), .fps = 1000, .repeat = 1},
+    {.key = '#', .name = "varredura_branca", .step = varredura, .arg = RGB(255, 255, 255), .fps = 1000, .repeat = 1},
+    {.key = '2', .name = "heartAnimation", .step = heartAnimation, .fps = 10, .repeat = 1},
+    {.key = '3', .name = "propeller", .step = propeller_step, .fps = 10, .repeat = 1},
+    {.key = '5', .name = "foguinho", .step = foguinho, .fps = FOGO_FPS, .repeat = 1},
+    {.key = '6', .name = "tetrix", .asset = np_asset_tetrix, .repeat = 1},
+    {.key = '7', .name = "animacao_loading", .asset = np_asset_loading, .repeat = 1},
+    {.key = '9', .name = "letreiro", .arg = RGB(255, 0, 0), .repeat = 1, .text = letreiro_texto},
+};
+
+const uint efeitos_count = sizeof(efeitos) / sizeof(efeitos[0]);
+
+/**
+ * Inicia um efeito da tabela, substituindo o que estiver em andamento.
+ */
+void iniciar_efeito_de(np_player_t *player, const efeito_t *e, uint64_t now)
+{
+    if (e->text)
+        npMarqueeStart(player, e->text, NP_COLOR(e->arg >> 16, e->arg >> 8 & 0xff, e->arg & 0xff), e->repeat, now);
+    else if (e->asset)
+        npAssetStart(player, e->asset, e->repeat, now);
+    else
+        npPlayerStart(player, e->step, e->arg, e->fps, e->repeat, now);
+}
+
+/**
+ * Inicia o efeito da tecla, substituindo o que estiver em andamento.
+ */
+bool iniciar_efeito(np_player_t *player, char key, uint64_t now)
+{
+    for (uint i = 0; i < efeitos_count; i++)
+    {
+        if (efeitos[i].key == key)
+        {
+            iniciar_efeito_de(player, &efeitos[i], now);
+            return true;
+        }
+    }
+    return false;
+}
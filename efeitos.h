@@ -0,0 +1,38 @@
+#ifndef EFEITOS_H
+#define EFEITOS_H
+
+#include "neopixel_anim.h"
+
+// Efeito de cada tecla: função de passo (ou animação compilada, ou texto do letreiro),
+// parâmetro, quadros por segundo da função de passo e repetições
+typedef struct
+{
+    char key;
+    const char *name;
+    np_step_fn step;
+    const uint8_t *asset;
+    uint32_t arg;
+    uint16_t fps;
+    uint repeat;
+    const char *text;
+} efeito_t;
+
+extern const efeito_t efeitos[];
+extern const uint efeitos_count;
+
+// Texto do letreiro (tecla 9), trocado por uma linha recebida no stdio.
+#define LETREIRO_MAX 64
+extern char letreiro_texto[LETREIRO_MAX + 1];
+
+// Fogo da tecla 5, separado do envio para medir só a simulação.
+void foguinho_iniciar(void);
+void foguinho_quadro(void);
+
+// A simulação do fogo sobre um calor de outro tamanho e a paleta (bench).
+void foguinho_simular(uint8_t *mapa, uint largura, uint altura);
+extern const npColor_t fogo_paleta[256];
+
+void iniciar_efeito_de(np_player_t *player, const efeito_t *e, uint64_t now);
+bool iniciar_efeito(np_player_t *player, char key, uint64_t now);
+
+#endif
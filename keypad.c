@@ -0,0 +1,184 @@
+#include "keypad.h"
+#include "prof.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "keypad.pio.h"
+
+/*
+ * Teclado 4x4 varrido pela PIO (keypad.pio).
+ *
+ * A máquina de estados alterna as linhas, lê as colunas e só envia o mapa de 16 bits
+ * quando ele muda. A interrupção de FIFO RX não vazia guarda o mapa mais recente e
+ * arma um alarme de hardware; se nada mudar por KEYPAD_DEBOUNCE_US, o alarme aceita o
+ * mapa e gera os eventos. O mesmo alarme cuida da repetição enquanto houver tecla
+ * pressionada. Os eventos vão para uma fila circular de um produtor (as interrupções,
+ * que não se interrompem entre si) e um consumidor (o laço principal), sem travas.
+ */
+
+uint _columns[4];
+uint _rows[4];
+char _matrix_values[16];
+
+static PIO keypad_pio;
+static uint keypad_sm;
+static uint keypad_alarm;
+
+// Estado do debounce (só tocados nas interrupções da PIO e do alarme).
+static volatile uint16_t candidate = 0;
+static volatile uint16_t debounced = 0;
+static uint64_t repeat_at;
+
+// Fila SPSC: head só é escrito pelo produtor, tail só pelo consumidor.
+static key_event_t queue[KEYPAD_QUEUE_SIZE];
+static volatile uint32_t queue_head = 0;
+static volatile uint32_t queue_tail = 0;
+static volatile uint32_t queue_dropped = 0;
+
+static void queue_push(char key, key_event_type_t type)
+{
+    uint32_t head = queue_head;
+    if (head - queue_tail == KEYPAD_QUEUE_SIZE)
+    {
+        queue_dropped++;
+        return;
+    }
+    queue[head & (KEYPAD_QUEUE_SIZE - 1)] = (key_event_t){key, type};
+    __dmb(); // O evento fica visível antes do novo head.
+    queue_head = head + 1;
+}
+
+/**
+ * Retira o próximo evento do teclado, se houver. Nunca bloqueia.
+ */
+bool pico_keypad_get_event(key_event_t *event)
+{
+    uint32_t tail = queue_tail;
+    if (tail == queue_head)
+        return false;
+    __dmb(); // Lê o evento só depois de ver o head.
+    *event = queue[tail & (KEYPAD_QUEUE_SIZE - 1)];
+    __dmb();
+    queue_tail = tail + 1;
+    return true;
+}
+
+// Mapa estável há KEYPAD_DEBOUNCE_US, ou hora de repetir as teclas mantidas.
+static void keypad_alarm_callback(uint alarm_num)
+{
+    PROF_BEGIN(PROF_KEYPAD);
+    uint64_t now = time_us_64();
+    uint16_t state = candidate;
+
+    if (state != debounced)
+    {
+        uint16_t pressed = state & ~debounced;
+        uint16_t released = debounced & ~state;
+        debounced = state;
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (released & (1u << i))
+                queue_push(_matrix_values[i], KEY_RELEASE);
+            if (pressed & (1u << i))
+                queue_push(_matrix_values[i], KEY_PRESS);
+        }
+        if (pressed)
+            repeat_at = now + KEYPAD_REPEAT_DELAY_US;
+    }
+    else if (state && now >= repeat_at)
+    {
+        for (int i = 0; i < 16; i++)
+            if (state & (1u << i))
+                queue_push(_matrix_values[i], KEY_REPEAT);
+        repeat_at += KEYPAD_REPEAT_PERIOD_US;
+    }
+
+    // Verdadeiro se o prazo já passou (interrupção atrasada) e o alarme não foi armado: a
+    // próxima repetição conta de agora, para as repetições não pararem.
+    if (debounced && hardware_alarm_set_target(alarm_num, from_us_since_boot(repeat_at)))
+    {
+        repeat_at = time_us_64() + KEYPAD_REPEAT_PERIOD_US;
+        hardware_alarm_set_target(alarm_num, from_us_since_boot(repeat_at));
+    }
+    PROF_END(PROF_KEYPAD);
+}
+
+// Novo mapa da PIO: reinicia a janela de debounce.
+static void keypad_pio_irq_handler(void)
+{
+    if (pio_sm_is_rx_fifo_empty(keypad_pio, keypad_sm))
+        return;
+    PROF_BEGIN(PROF_KEYPAD);
+    while (!pio_sm_is_rx_fifo_empty(keypad_pio, keypad_sm))
+        candidate = pio_sm_get(keypad_pio, keypad_sm) >> 16;
+    hardware_alarm_set_target(keypad_alarm, make_timeout_time_us(KEYPAD_DEBOUNCE_US));
+    PROF_END(PROF_KEYPAD);
+}
+
+// inicializa o keypad; linhas e colunas devem estar em pinos consecutivos
+void pico_keypad_init(uint columns[4], uint rows[4], char matrix_values[16])
+{
+
+    for (int i = 0; i < 16; i++)
+    {
+        _matrix_values[i] = matrix_values[i];
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        _columns[i] = columns[i];
+        _rows[i] = rows[i];
+    }
+
+    keypad_alarm = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(keypad_alarm, keypad_alarm_callback);
+
+    // pio0 se ela tiver espaço para o programa e uma máquina livre, senão pio1.
+    keypad_pio = pio0;
+    int claimed = pio_can_add_program(pio0, &keypad_program) ? pio_claim_unused_sm(pio0, false) : -1;
+    if (claimed < 0)
+    {
+        keypad_pio = pio1;
+        claimed = pio_claim_unused_sm(keypad_pio, true);
+    }
+    keypad_sm = claimed;
+    uint offset = pio_add_program(keypad_pio, &keypad_program);
+
+    uint irq = pio_get_index(keypad_pio) ? PIO1_IRQ_0 : PIO0_IRQ_0;
+    irq_add_shared_handler(irq, keypad_pio_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    pio_set_irq0_source_enabled(keypad_pio, pis_sm0_rx_fifo_not_empty + keypad_sm, true);
+    irq_set_enabled(irq, true);
+
+    keypad_program_init(keypad_pio, keypad_sm, offset, _rows[0], _columns[0], KEYPAD_PIO_FREQ);
+}
+
+/**
+ * Primeira tecla pressionada no estado atual (após debounce), ou 0. Não bloqueia.
+ */
+char pico_keypad_get_key(void)
+{
+    uint16_t state = debounced;
+    for (int i = 0; i < 16; i++)
+        if (state & (1u << i))
+            return _matrix_values[i];
+    return 0;
+}
+
+/**
+ * Mapa das 16 teclas após debounce (bit linha * 4 + coluna), com várias teclas ao mesmo tempo.
+ */
+uint16_t pico_keypad_get_state(void)
+{
+    return debounced;
+}
+
+/**
+ * Eventos descartados por fila cheia.
+ */
+uint32_t pico_keypad_dropped_events(void)
+{
+    return queue_dropped;
+}
@@ -0,0 +1,38 @@
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+#include "pico/stdlib.h"
+
+// Clock da máquina de estados da varredura (keypad.pio): ~1,2 ms por varredura a 1 MHz.
+#define KEYPAD_PIO_FREQ 1000000.f
+
+// Tempo sem mudança no mapa para aceitá-lo (debounce).
+#define KEYPAD_DEBOUNCE_US 15000
+
+// Tecla mantida: primeira repetição e intervalo entre as seguintes.
+#define KEYPAD_REPEAT_DELAY_US 500000
+#define KEYPAD_REPEAT_PERIOD_US 500000
+
+// Capacidade da fila de eventos (potência de 2).
+#define KEYPAD_QUEUE_SIZE 16
+
+typedef enum
+{
+    KEY_PRESS,
+    KEY_RELEASE,
+    KEY_REPEAT,
+} key_event_type_t;
+
+typedef struct
+{
+    char key;
+    uint8_t type; // key_event_type_t
+} key_event_t;
+
+void pico_keypad_init(uint columns[4], uint rows[4], char matrix_values[16]);
+bool pico_keypad_get_event(key_event_t *event);
+char pico_keypad_get_key(void);
+uint16_t pico_keypad_get_state(void);
+uint32_t pico_keypad_dropped_events(void);
+
+#endif
@@ -0,0 +1,464 @@
+#include <string.h>
+#include "neopixel.h"
+#include "neopixel_gamma.h"
+#include "prof.h"
+#include "ws2818b.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Dois quadros: o de trás recebe o desenho, o da frente é codificado para a linha.
+static npColor_t np_frames[2][LED_COUNT + 1];
+npColor_t *leds = np_frames[0];
+static npColor_t *np_front = np_frames[1];
+
+// Variáveis para uso da máquina PIO.
+PIO np_pio;
+uint sm;
+
+// Formato escolhido em npInitMode() e quadro codificado para a linha (bytes GRB, ou uma
+// palavra por pixel no modo de 24 bits), já com gama e brilho. É o que o DMA lê.
+static np_mode_t np_mode;
+static uint32_t np_wire[LED_COUNT];
+
+// np_wire ainda não corresponde aos LEDs (antes do primeiro envio).
+static bool np_wire_stale = true;
+
+// Bytes de cor que deixaram de ir para a linha: quadros sem mudança e pixels depois do último que mudou.
+static volatile uint32_t np_saved_bytes = 0;
+
+// Tabela de gama do brilho atual (ver neopixel_gamma.h).
+const uint16_t *volatile np_lut = np_gamma_lut[NP_BRIGHTNESS_DEFAULT];
+
+// Pontilhamento temporal: com ele, o quadro da frente é reenviado enquanto algum canal tiver
+// fração (np_dither_residue) e cada canal acumula a fração que a tabela 8.8 perdeu no passo
+// de 8 bits (modulação sigma-delta).
+static volatile bool np_dither = false;
+static uint8_t np_dither_err[LED_COUNT * 3];
+static bool np_dither_residue = false;
+
+// Início mais cedo do próximo reenvio: a codificação na interrupção ocupa no máximo
+// 1/NP_DITHER_LOAD do núcleo, em qualquer tamanho de tela.
+#define NP_DITHER_LOAD 4
+static uint32_t np_dither_next_us;
+
+// Canal DMA que alimenta a FIFO TX da máquina PIO.
+static int np_dma_chan;
+
+// np_busy: há um quadro apresentado que o transmissor ainda não aceitou (sem pontilhamento,
+// até o fim do seu RESET; com ele, até ser codificado). np_running: DMA ou RESET na linha.
+static volatile bool np_busy = false;
+static volatile bool np_running = false;
+static np_write_callback_t np_callback = NULL;
+
+// Números dos quadros apresentado, codificado na linha e já travado nos LEDs.
+static volatile uint32_t np_present_seq = 0;
+static volatile uint32_t np_sent_seq = 0;
+static volatile uint32_t np_shown_seq = 0;
+
+// Alarmes do RESET no núcleo que chamou npInitMode(), junto com a interrupção do DMA.
+static alarm_pool_t *np_alarm_pool;
+
+// Fim real dos dados na linha: FIFO TX vazia e máquina parada no autopull (TXSTALL, sticky,
+// limpo a cada fim de DMA). O RESET conta a partir dele.
+static uint32_t np_txstall;
+
+static int64_t np_latch_callback(alarm_id_t id, void *user_data);
+
+// Sigma-delta de NP_DITHER_BITS: o valor 8.8 perde os bits de baixo e o resto se acumula.
+static inline uint32_t np_dither8(uint16_t v, uint8_t *err)
+{
+    uint32_t acc = (v >> (8 - NP_DITHER_BITS)) + *err;
+    *err = acc & ((1u << NP_DITHER_BITS) - 1);
+    return acc >> NP_DITHER_BITS;
+}
+
+/**
+ * Codifica o quadro da frente em np_wire, com gama, brilho e, se ativo, pontilhamento.
+ *
+ * Os pixels já estão na ordem física e no formato da linha: cada palavra só tem os três
+ * bytes de cor trocados pela tabela, sem rearranjo. np_wire guarda o que os LEDs mostram,
+ * então cada pixel codificado é comparado com ele. Retorna quantos pixels enviar: até o
+ * último que mudou (0 se nenhum), já que o WS2812 mantém a cor travada nos que não
+ * recebem dados. Com pontilhamento, também anota se algum canal tem fração a acumular.
+ */
+static uint np_encode(void)
+{
+    PROF_BEGIN(PROF_NP_ENCODE);
+    const uint16_t *lut = np_lut;
+    uint8_t *err = np_dither_err;
+    uint8_t *bytes = (uint8_t *)np_wire; // 8 bits: um byte por push (G, R, B), em ordem.
+    uint len = 0;
+    uint frac = 0;
+
+    for (uint i = 0; i < LED_COUNT; ++i, err += 3)
+    {
+        npColor_t c = np_front[i];
+        uint32_t w;
+        if (np_dither)
+        {
+            uint16_t g = lut[(uint8_t)(c >> 24)], r = lut[(uint8_t)(c >> 16)], b = lut[(uint8_t)(c >> 8)];
+            frac |= g | r | b;
+            w = np_dither8(g, err) << 24 | np_dither8(r, err + 1) << 16 | np_dither8(b, err + 2) << 8;
+        }
+        else
+            w = (uint32_t)np_lut8(lut, c >> 24) << 24 | (uint32_t)np_lut8(lut, c >> 16) << 16 |
+                (uint32_t)np_lut8(lut, c >> 8) << 8;
+
+        if (np_mode == NP_MODE_GRB24)
+        {
+            if (np_wire[i] != w)
+            {
+                np_wire[i] = w;
+                len = i + 1;
+            }
+        }
+        else
+        {
+            uint8_t *b = &bytes[3 * i];
+            if (b[0] != (uint8_t)(w >> 24) || b[1] != (uint8_t)(w >> 16) || b[2] != (uint8_t)(w >> 8))
+            {
+                b[0] = w >> 24;
+                b[1] = w >> 16;
+                b[2] = w >> 8;
+                len = i + 1;
+            }
+        }
+    }
+
+    // O primeiro quadro vai inteiro: os LEDs podem ter ficado acesos antes de um reinício.
+    if (np_wire_stale)
+    {
+        np_wire_stale = false;
+        len = LED_COUNT;
+    }
+    np_dither_residue = (frac >> (8 - NP_DITHER_BITS)) & ((1u << NP_DITHER_BITS) - 1);
+    PROF_END(PROF_NP_ENCODE);
+    return len;
+}
+
+/**
+ * Codifica o quadro da frente e dispara o DMA até o último pixel que mudou. A linha deve estar livre.
+ *
+ * Sem mudança, nada é transmitido e o quadro conta como travado na hora. Com pontilhamento,
+ * o reenvio seguinte espera um RESET, para não codificar sem parar na interrupção. Só os
+ * envios de quadros apresentados (ou de npRefresh()) contam em npGetSavedBytes().
+ */
+static void np_send(void)
+{
+    uint32_t seq = np_present_seq;
+    bool presented = np_busy;
+    uint32_t start_us = time_us_32();
+    uint len = np_encode();
+    np_sent_seq = seq;
+    if (np_dither)
+    {
+        np_busy = false; // O quadro foi aceito; os próximos reenvios são só pontilhamento.
+        np_dither_next_us = start_us + NP_DITHER_LOAD * (time_us_32() - start_us);
+    }
+    np_running = true;
+    if (presented)
+        np_saved_bytes += (LED_COUNT - len) * 3;
+
+    if (!len)
+    {
+        if (!np_dither)
+        {
+            np_latch_callback(0, NULL);
+            return;
+        }
+        if (alarm_pool_add_alarm_in_us(np_alarm_pool, NP_RESET_US, np_latch_callback, NULL, true) >= 0)
+            return;
+
+        // Sem alarme livre: reenvia o primeiro pixel, e o fim do DMA agenda o RESET.
+        len = 1;
+        if (presented)
+            np_saved_bytes -= 3;
+    }
+    dma_channel_transfer_from_buffer_now(np_dma_chan, np_wire, np_mode == NP_MODE_GRB24 ? len : len * 3);
+}
+
+/**
+ * Fim do RESET: o quadro está travado nos LEDs. Com um quadro pendente, ou com pontilhamento
+ * e alguma fração a acumular, a linha já recebe o próximo envio; senão fica livre.
+ *
+ * Os reenvios do pontilhamento não começam antes de np_dither_next_us: até lá, este alarme
+ * é reagendado, sem codificar.
+ */
+static int64_t np_latch_callback(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+    bool novo = np_sent_seq != np_shown_seq;
+    np_shown_seq = np_sent_seq;
+
+    // Antes do próximo envio, que pode travar outro quadro sem transmitir e chamar o callback de novo.
+    if (novo && np_callback)
+        np_callback();
+
+    if (np_sent_seq != np_present_seq)
+        np_send();
+    else if (np_dither && np_dither_residue)
+    {
+        int32_t wait_us = (int32_t)(np_dither_next_us - time_us_32());
+        if (wait_us <= 0 || alarm_pool_add_alarm_in_us(np_alarm_pool, wait_us, np_latch_callback, NULL, true) < 0)
+            np_send();
+    }
+    else
+    {
+        np_running = false;
+        np_busy = false;
+    }
+    return 0; // Não reagenda.
+}
+
+/**
+ * Confere se a linha terminou os dados e, se sim, agenda o fim do RESET a partir deste instante.
+ *
+ * Até lá, repete a conferência a cada NP_DRAIN_POLL_US.
+ */
+static int64_t np_drain_callback(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+    if (!pio_sm_is_tx_fifo_empty(np_pio, sm) || !(np_pio->fdebug & np_txstall))
+        return NP_DRAIN_POLL_US;
+
+    if (alarm_pool_add_alarm_in_us(np_alarm_pool, NP_RESET_US, np_latch_callback, NULL, true) < 0)
+        np_latch_callback(0, NULL);
+    return 0;
+}
+
+/**
+ * Fim do DMA: os bytes estão na FIFO, falta esvaziá-la e aguardar o RESET.
+ *
+ * O tempo até o fim dos dados é estimado pelo nível da FIFO (mais a palavra no OSR), e só
+ * então o alarme confere a parada da máquina: nenhum pior caso fixo entra no RESET.
+ */
+static void np_dma_irq_handler(void)
+{
+    if (!dma_channel_get_irq0_status(np_dma_chan))
+        return;
+    dma_channel_acknowledge_irq0(np_dma_chan);
+
+    // A máquina ainda tem dados: a parada registrada é a do quadro anterior.
+    np_pio->fdebug = np_txstall;
+
+    // Sem alarme livre, libera o buffer imediatamente (o próximo quadro pode encurtar o RESET).
+    uint word_us = np_mode == NP_MODE_GRB24 ? NP_WORD_24_US : NP_WORD_US;
+    uint drain_us = (pio_sm_get_tx_fifo_level(np_pio, sm) + 1) * word_us;
+    if (alarm_pool_add_alarm_in_us(np_alarm_pool, drain_us, np_drain_callback, NULL, true) < 0)
+        np_latch_callback(0, NULL);
+}
+
+/**
+ * Inicializa a máquina PIO para controle da matriz de LEDs.
+ */
+void npInit(uint pin)
+{
+    npInitMode(pin, NP_MODE_GRB8);
+}
+
+/**
+ * Inicializa a máquina PIO no formato de FIFO indicado.
+ */
+void npInitMode(uint pin, np_mode_t mode)
+{
+    // Toma posse de uma máquina PIO na pio0 se houver espaço para o programa, senão na pio1.
+    np_pio = pio0;
+    int claimed = pio_can_add_program(pio0, &ws2818b_program) ? pio_claim_unused_sm(pio0, false) : -1;
+    if (claimed < 0)
+    {
+        np_pio = pio1;
+        claimed = pio_claim_unused_sm(np_pio, true); // Se nenhuma máquina estiver livre, panic!
+    }
+    sm = claimed;
+
+    // Cria programa PIO na mesma PIO da máquina.
+    uint offset = pio_add_program(np_pio, &ws2818b_program);
+
+    // Inicia programa na máquina PIO obtida.
+    np_mode = mode;
+    np_txstall = 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    if (mode == NP_MODE_GRB24)
+        ws2818b_24_program_init(np_pio, sm, offset, pin, 800000.f);
+    else
+        ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+
+    // Configura o DMA: um byte GRB (ou uma palavra por pixel) a cada pedido (DREQ) da FIFO TX.
+    np_dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(np_dma_chan);
+    channel_config_set_transfer_data_size(&c, mode == NP_MODE_GRB24 ? DMA_SIZE_32 : DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(np_pio, sm, true));
+    dma_channel_configure(np_dma_chan, &c, &np_pio->txf[sm], np_wire, LED_COUNT * 3, false);
+
+    np_alarm_pool = alarm_pool_create_with_unused_hardware_alarm(4);
+
+    dma_channel_set_irq0_enabled(np_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, np_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    // Limpa os dois buffers de pixels.
+    memset(np_frames, 0, sizeof(np_frames));
+}
+
+/**
+ * Atribui uma cor RGB a um LED.
+ */
+void npSetLED(const uint index, const uint8_t r, const uint8_t g, const uint8_t b)
+{
+    leds[index] = NP_COLOR(r, g, b);
+}
+
+/**
+ * Limpa o buffer de pixels.
+ */
+void npClear()
+{
+    memset(leds, 0, sizeof(np_frames[0]));
+}
+
+/**
+ * Troca os buffers: o quadro desenhado passa ao transmissor, sem cópia.
+ *
+ * O DMA lê o quadro já codificado (np_wire), então a troca não espera a linha.
+ * Depois dela, "leds" aponta para o quadro antigo, que deve ser redesenhado por inteiro.
+ */
+void npSwap(void)
+{
+    npColor_t *back = leds;
+    leds = np_front;
+    np_front = back;
+}
+
+/**
+ * Copia o quadro da frente (o último apresentado) para o buffer de trás, para desenhar
+ * sobre ele depois de npSwap() ou npPresent().
+ */
+void npCopyFront(void)
+{
+    memcpy(leds, np_front, sizeof(np_frames[0]));
+}
+
+/**
+ * Troca os buffers e envia o novo quadro da frente aos LEDs.
+ *
+ * Não bloqueia: o DMA envia os bytes GRB à máquina PIO e o fim do quadro
+ * (incluindo o RESET) é sinalizado pelo callback de npSetWriteCallback().
+ * Só espera se o quadro anterior ainda não foi aceito pelo transmissor.
+ */
+void npPresent(void)
+{
+    npWait();
+    npSwap();
+
+    // Nesta ordem: um reenvio que pegue o quadro novo antes do número ainda o conta como antigo.
+    np_present_seq++;
+    np_busy = true;
+    if (!np_running)
+        np_send();
+}
+
+/**
+ * Reenvia o quadro da frente, codificado de novo com a tabela de brilho atual.
+ *
+ * Serve para aplicar npSetBrightness() a um quadro parado, sem redesenhá-lo. Se o
+ * pontilhamento ainda reenvia o quadro, a nova tabela vale no próximo reenvio e nada é feito.
+ */
+void npRefresh(void)
+{
+    if (np_dither && np_running)
+        return;
+    npWait();
+    np_busy = true;
+    np_send();
+}
+
+/**
+ * Liga ou desliga o pontilhamento temporal.
+ *
+ * Ligado, enquanto algum canal do quadro da frente tiver fração a acumular, a linha o
+ * reenvia na maior taxa possível (um quadro a cada ~1,1 ms com 25 LEDs), limitada para a
+ * codificação na interrupção do RESET não passar de 1/NP_DITHER_LOAD do núcleo. Um quadro
+ * sem fração (apagado, por exemplo) é enviado uma vez e a linha para.
+ * Deve ser chamada no núcleo que chamou npInitMode().
+ */
+void npSetDither(bool on)
+{
+    np_dither = on;
+    if (on && !np_running)
+        np_send();
+}
+
+/**
+ * Escolhe o brilho global (0 apaga, NP_BRIGHTNESS_LEVELS - 1 é o máximo).
+ *
+ * Só troca a tabela: vale a partir do próximo quadro enviado (ou de npRefresh()).
+ */
+void npSetBrightness(uint level)
+{
+    if (level >= NP_BRIGHTNESS_LEVELS)
+        level = NP_BRIGHTNESS_LEVELS - 1;
+    np_lut = np_gamma_lut[level];
+}
+
+/**
+ * Nível de brilho atual.
+ */
+uint npGetBrightness(void)
+{
+    return (np_lut - np_gamma_lut[0]) / 256;
+}
+
+/**
+ * Escreve os dados do buffer nos LEDs.
+ *
+ * Como npPresent(), mas o quadro enviado é copiado de volta ao buffer de trás,
+ * para animações que desenham sobre o quadro anterior.
+ */
+void npWrite()
+{
+    PROF_BEGIN(PROF_NP_WRITE);
+    npPresent();
+    npCopyFront();
+    PROF_END(PROF_NP_WRITE);
+}
+
+/**
+ * Indica se o último quadro apresentado ainda não foi aceito pelo transmissor
+ * (sem pontilhamento: ainda está sendo transmitido ou aguardando o RESET).
+ */
+bool npBusy(void)
+{
+    return np_busy;
+}
+
+/**
+ * Aguarda até o transmissor aceitar um novo quadro (ver npBusy()).
+ */
+void npWait(void)
+{
+    while (np_busy)
+        tight_loop_contents();
+}
+
+/**
+ * Registra a função chamada quando cada quadro novo é travado (NULL desativa).
+ * Reenvios do mesmo quadro, como os do pontilhamento, não a chamam. Um quadro igual
+ * ao dos LEDs conta como travado já em npPresent(), e a chama fora da interrupção.
+ */
+void npSetWriteCallback(np_write_callback_t callback)
+{
+    np_callback = callback;
+}
+
+/**
+ * Bytes de cor que não precisaram ser transmitidos desde o boot (quadros apresentados sem
+ * mudança e pixels depois do último que mudou; os reenvios do pontilhamento não contam).
+ * Dá a volta em 2^32.
+ */
+uint32_t npGetSavedBytes(void)
+{
+    return np_saved_bytes;
+}
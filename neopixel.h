@@ -0,0 +1,69 @@
+#ifndef NEOPIXEL_H
+#define NEOPIXEL_H
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "neopixel_layout.h"
+
+// Definição do número de LEDs na fita (gerado a partir dos painéis, ver CMakeLists.txt).
+#define LED_COUNT NP_LED_COUNT
+
+// Tempo de RESET (latch) exigido pelo WS2812 após o último bit, em us.
+#define NP_RESET_US 100
+
+// Tempo de linha de uma palavra da FIFO TX, a 1,25us por bit.
+#define NP_WORD_US 10    // 8 bits por palavra.
+#define NP_WORD_24_US 30 // 24 bits por palavra.
+
+// Intervalo entre as conferências do fim dos dados, quando a estimativa pelo nível da FIFO foi curta.
+#define NP_DRAIN_POLL_US 5
+
+// Pixel do quadro, empacotado na ordem da linha: 0xGGRRBB00 (a palavra do modo de 24 bits).
+typedef uint32_t npColor_t;
+#define NP_COLOR(r, g, b) ((npColor_t)(g) << 24 | (npColor_t)(r) << 16 | (npColor_t)(b) << 8)
+
+// Formato das palavras na FIFO TX da máquina PIO (ver ws2818b.pio).
+typedef enum
+{
+    NP_MODE_GRB8,  // Um byte por push: G, R e B separados (3 escritas por pixel), MSB primeiro.
+    NP_MODE_GRB24, // Uma palavra 0xGGRRBB00 por pixel, MSB primeiro.
+} np_mode_t;
+
+// Callback chamado (em geral em contexto de interrupção) quando um quadro termina de ser travado nos LEDs.
+typedef void (*np_write_callback_t)(void);
+
+// Buffer de trás, onde as animações desenham, na ordem física da fita. O da frente
+// pertence ao transmissor. Ambos têm LED_COUNT + 1 pixels: o último recebe os pontos da
+// tela sem LED (ver npXY()) e nunca é enviado.
+extern npColor_t *leds;
+
+// Variáveis para uso da máquina PIO.
+extern PIO np_pio;
+extern uint sm;
+
+void npInit(uint pin);
+void npInitMode(uint pin, np_mode_t mode);
+void npSetLED(const uint index, const uint8_t r, const uint8_t g, const uint8_t b);
+
+/**
+ * Índice na fita do ponto (x, y) da tela lógica, (0, 0) embaixo à esquerda.
+ * Pontos sem LED (buracos entre painéis) dão LED_COUNT.
+ */
+static inline uint npXY(uint x, uint y)
+{
+    return np_xy[y][x];
+}
+void npClear();
+void npWrite();
+void npSwap(void);
+void npCopyFront(void);
+void npPresent(void);
+void npRefresh(void);
+void npSetDither(bool on);
+
+bool npBusy(void);
+void npWait(void);
+void npSetWriteCallback(np_write_callback_t callback);
+uint32_t npGetSavedBytes(void);
+
+#endif
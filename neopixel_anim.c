@@ -0,0 +1,182 @@
+#include "neopixel_anim.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+#include "prof.h"
+
+// Alarme de hardware do governador, tomado pela primeira animação (no núcleo que desenha), e
+// a animação que ele apresenta: uma por vez.
+static int np_gov_alarm = -1;
+static np_player_t *volatile np_gov_player = NULL;
+static volatile np_governor_stats_t np_gov_stats;
+
+/**
+ * Apresenta o quadro pronto e passa o prazo para o próximo. Se a linha ainda estiver
+ * ocupada com o quadro anterior, o prazo é perdido e o alarme vai para o próximo ponto da grade.
+ */
+static void np_gov_present(np_player_t *p)
+{
+    while (true)
+    {
+        uint64_t now = time_us_64();
+        if (!npBusy())
+        {
+            npWrite();
+            uint32_t jitter = (uint32_t)(now - p->deadline);
+            np_gov_stats.frames++;
+            np_gov_stats.jitter_sum_us += jitter;
+            if (jitter > np_gov_stats.jitter_max_us)
+                np_gov_stats.jitter_max_us = jitter;
+
+            p->deadline += (uint64_t)p->hold * p->period_us;
+            p->ready = false;
+            __sev(); // Acorda o laço que desenha o próximo quadro.
+            return;
+        }
+        np_gov_stats.missed++;
+        p->deadline += p->period_us;
+
+        // Retorna falso se o alarme foi armado; verdadeiro se o prazo também já passou.
+        if (!hardware_alarm_set_target(np_gov_alarm, from_us_since_boot(p->deadline)))
+            return;
+    }
+}
+
+static void np_gov_alarm_callback(uint alarm_num)
+{
+    (void)alarm_num;
+    np_player_t *p = np_gov_player;
+    if (p && p->ready)
+        np_gov_present(p);
+}
+
+/**
+ * Agenda a apresentação do quadro recém-desenhado. O primeiro quadro de uma animação sai
+ * já, e a grade começa nele; os demais, no seu prazo, ou no primeiro ponto da grade
+ * depois de agora se o desenho terminou tarde.
+ */
+static void np_gov_arm(np_player_t *p, bool first)
+{
+    uint64_t now = time_us_64();
+
+    if (first)
+        p->deadline = now;
+    else if (p->deadline < now)
+    {
+        uint32_t late = (uint32_t)((now - p->deadline + p->period_us - 1) / p->period_us);
+        np_gov_stats.missed += late;
+        p->deadline += (uint64_t)late * p->period_us;
+    }
+
+    if (hardware_alarm_set_target(np_gov_alarm, from_us_since_boot(p->deadline)))
+        np_gov_present(p);
+}
+
+/**
+ * Inicia uma animação definida por uma função de passo, a fps quadros por segundo; o
+ * primeiro quadro é desenhado no próximo npPlayerRun() e apresentado em seguida.
+ */
+void npPlayerStart(np_player_t *p, np_step_fn step, uint32_t arg, uint fps, uint repeat, uint64_t now)
+{
+    if (np_gov_alarm < 0)
+    {
+        np_gov_alarm = hardware_alarm_claim_unused(true);
+        hardware_alarm_set_callback(np_gov_alarm, np_gov_alarm_callback);
+    }
+
+    // Descarta o quadro pendente da animação anterior.
+    hardware_alarm_cancel(np_gov_alarm);
+    np_gov_player = p;
+
+    p->step = step;
+    p->data = NULL;
+    p->arg = arg;
+    p->frame = 0;
+    p->delta = 0;
+    p->repeat = repeat ? repeat : 1;
+    p->period_us = 1000000 / (fps ? fps : 1);
+    p->hold = 0;
+    p->ready = false;
+    p->done = false;
+    p->deadline = now;
+}
+
+/**
+ * Interrompe a animação; o último quadro apresentado permanece nos LEDs.
+ */
+void npPlayerStop(np_player_t *p)
+{
+    if (np_gov_player == p)
+        hardware_alarm_cancel(np_gov_alarm);
+    p->ready = false;
+    p->step = NULL;
+}
+
+/**
+ * Desenha o próximo quadro se o anterior já foi apresentado. Nunca espera; retorna falso
+ * quando a animação acabou (depois do período do seu último quadro).
+ */
+bool npPlayerRun(np_player_t *p, uint64_t now)
+{
+    while (p->step && !p->ready && !p->done)
+    {
+        PROF_BEGIN(PROF_RENDER);
+        uint32_t hold = p->step(p);
+        PROF_END(PROF_RENDER);
+        if (hold != NP_STEP_DONE)
+        {
+            bool first = !p->hold;
+            p->hold = hold ? hold : 1;
+            p->ready = true;
+            np_gov_arm(p, first);
+            break;
+        }
+
+        if (p->repeat > 1)
+        {
+            p->repeat--;
+            p->frame = 0;
+            p->delta = 0;
+        }
+        else
+            p->done = true;
+    }
+
+    if (p->done && now >= p->deadline)
+    {
+        p->step = NULL;
+        if (np_gov_player == p)
+            np_gov_player = NULL;
+    }
+    return p->step != NULL;
+}
+
+/**
+ * Roda a animação até o fim, dormindo entre os quadros.
+ */
+void npPlayerFinish(np_player_t *p)
+{
+    while (npPlayerRun(p, time_us_64()))
+        best_effort_wfe_or_timeout(from_us_since_boot(p->deadline));
+}
+
+/**
+ * Copia as estatísticas do governador.
+ */
+void npGovernorStats(np_governor_stats_t *stats)
+{
+    stats->frames = np_gov_stats.frames;
+    stats->missed = np_gov_stats.missed;
+    stats->jitter_max_us = np_gov_stats.jitter_max_us;
+    stats->jitter_sum_us = np_gov_stats.jitter_sum_us;
+}
+
+/**
+ * Zera as estatísticas do governador.
+ */
+void npGovernorReset(void)
+{
+    np_gov_stats.frames = 0;
+    np_gov_stats.missed = 0;
+    np_gov_stats.jitter_max_us = 0;
+    np_gov_stats.jitter_sum_us = 0;
+}
@@ -0,0 +1,59 @@
+#ifndef NEOPIXEL_ANIM_H
+#define NEOPIXEL_ANIM_H
+
+#include "neopixel.h"
+
+/*
+ * Governador de quadros: cada animação declara seus quadros por segundo e seus passos só
+ * desenham no buffer de trás. O quadro desenhado é apresentado (npWrite) por um alarme de
+ * hardware no seu prazo, numa grade absoluta (início + n períodos): o tempo de desenho e de
+ * transmissão não se soma ao período e o atraso de um quadro não passa para os seguintes.
+ *
+ * O próximo quadro é desenhado logo depois da apresentação do anterior, enquanto este é
+ * transmitido. Se ainda não estiver pronto no seu prazo (ou a linha ainda estiver ocupada),
+ * o prazo é perdido e o quadro sai no próximo ponto da grade.
+ */
+
+// Devolvido por um step() quando a animação terminou (nada novo a apresentar).
+#define NP_STEP_DONE UINT32_MAX
+
+typedef struct np_player np_player_t;
+
+// Desenha o próximo quadro no buffer de trás, sem enviar; retorna por quantos períodos ele
+// fica na tela (pelo menos 1) ou NP_STEP_DONE.
+typedef uint32_t (*np_step_fn)(np_player_t *p);
+
+// Animação em andamento: máquina de estados retomada pelo laço principal a cada quadro apresentado.
+struct np_player
+{
+    np_step_fn step;            // NULL quando parado.
+    const void *data;           // Dados livres da animação (ex.: texto do letreiro).
+    uint32_t arg;               // Parâmetro livre da animação (ex.: cor).
+    uint frame;                 // Próximo quadro (ou passo).
+    uint delta;                 // Posição livre do passo (ex.: byte do blob, caractere do texto).
+    uint repeat;                // Execuções restantes, incluindo a atual.
+    uint32_t period_us;         // 1 s / fps.
+    uint32_t hold;              // Períodos do quadro desenhado.
+    volatile bool ready;        // Quadro desenhado, esperando o prazo.
+    bool done;                  // Último quadro apresentado; termina no fim do seu período.
+    volatile uint64_t deadline; // Prazo do próximo quadro (ou fim da animação, se done).
+};
+
+// Prazos e apresentações desde npGovernorReset().
+typedef struct
+{
+    uint32_t frames;        // Quadros apresentados.
+    uint32_t missed;        // Pontos da grade perdidos (quadro não pronto ou linha ocupada).
+    uint32_t jitter_max_us; // Maior atraso de uma apresentação em relação ao seu prazo.
+    uint64_t jitter_sum_us;
+} np_governor_stats_t;
+
+void npPlayerStart(np_player_t *p, np_step_fn step, uint32_t arg, uint fps, uint repeat, uint64_t now);
+void npPlayerStop(np_player_t *p);
+bool npPlayerRun(np_player_t *p, uint64_t now);
+void npPlayerFinish(np_player_t *p);
+
+void npGovernorStats(np_governor_stats_t *stats);
+void npGovernorReset(void);
+
+#endif
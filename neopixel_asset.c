@@ -0,0 +1,134 @@
+#include <string.h>
+#include "neopixel_asset.h"
+#include "neopixel_draw.h"
+
+static inline uint np_asset_colors(const uint8_t *a)
+{
+    return a[7] ? a[7] : 256;
+}
+
+static inline uint np_asset_frames(const uint8_t *a)
+{
+    return a[8] | a[9] << 8;
+}
+
+/**
+ * Confere um blob lido de arquivo antes de tocá-lo: assinatura, quadros dentro de "size"
+ * bytes e cada registro dos quadros (tamanho múltiplo do registro, espera de pelo menos
+ * um período, cor dentro da paleta). Um blob aprovado não leva npAssetStep() a ler fora dele.
+ */
+bool npAssetCheck(const uint8_t *asset, size_t size)
+{
+    if (size < NP_ASSET_HEADER || memcmp(asset, "NPA\x01", 4) != 0 || !asset[4] || !asset[5] || !asset[6])
+        return false;
+
+    uint colors = np_asset_colors(asset);
+    size_t pos = NP_ASSET_HEADER + 3 * colors;
+    if (pos > size)
+        return false;
+    for (uint i = 0; i < np_asset_frames(asset); ++i)
+    {
+        if (pos + 4 > size || asset[pos] > NP_ASSET_DELTA || !asset[pos + 1])
+            return false;
+        size_t len = asset[pos + 2] | asset[pos + 3] << 8;
+        uint rec = asset[pos] == NP_ASSET_KEY ? 2 : 3; // (n - 1, cor) ou (pula, n, cor)
+        pos += 4;
+        if (len > size - pos || len % rec)
+            return false;
+        for (size_t j = rec - 1; j < len; j += rec)
+            if (asset[pos + j] >= colors)
+                return false;
+        pos += len;
+    }
+    return true;
+}
+
+/**
+ * Inicia a animação compilada, na grade de quadros do blob.
+ */
+void npAssetStart(np_player_t *p, const uint8_t *asset, uint repeat, uint64_t now)
+{
+    npPlayerStart(p, npAssetStep, 0, asset[6], repeat, now);
+    p->data = asset;
+}
+
+// Ponto do quadro em que o decodificador está: índice (de baixo para cima, da esquerda
+// para a direita) e sua coluna e linha, levadas de um registro ao outro sem divisão.
+typedef struct
+{
+    uint pos, x, y;
+} np_asset_cursor_t;
+
+// Avança "n" pontos sem pintar.
+static void np_asset_skip(np_asset_cursor_t *c, uint width, uint n)
+{
+    c->pos += n;
+    c->x += n;
+    while (c->x >= width)
+    {
+        c->x -= width;
+        c->y++;
+    }
+}
+
+// Pinta "run" pontos seguidos, em segmentos de linha, recortando no fim do quadro.
+static void np_asset_fill(np_asset_cursor_t *c, uint width, uint count, uint run, const uint8_t *rgb)
+{
+    npColor_t color = NP_COLOR(rgb[0], rgb[1], rgb[2]);
+    if (run > count - c->pos)
+        run = count - c->pos;
+    c->pos += run;
+    while (run)
+    {
+        uint n = run < width - c->x ? run : width - c->x;
+        npHSpan(c->x, c->y, n, color);
+        run -= n;
+        c->x += n;
+        if (c->x == width)
+        {
+            c->x = 0;
+            c->y++;
+        }
+    }
+}
+
+/**
+ * Passo das animações compiladas: decodifica o próximo quadro do blob.
+ *
+ * p->frame é o quadro e p->delta o byte do blob em que ele começa (0 no início).
+ */
+uint32_t npAssetStep(np_player_t *p)
+{
+    const uint8_t *a = p->data;
+    if (p->frame == np_asset_frames(a))
+        return NP_STEP_DONE;
+
+    const uint8_t *palette = a + NP_ASSET_HEADER;
+    if (!p->delta)
+        p->delta = NP_ASSET_HEADER + 3 * np_asset_colors(a);
+
+    const uint8_t *f = a + p->delta;
+    uint len = f[2] | f[3] << 8;
+    const uint8_t *d = f + 4, *end = d + len;
+    p->delta += 4 + len;
+    p->frame++;
+
+    uint width = a[4], count = a[4] * a[5];
+    np_asset_cursor_t c = {0, 0, 0};
+    if (f[0] == NP_ASSET_KEY)
+    {
+        for (; d < end && c.pos < count; d += 2)
+            np_asset_fill(&c, width, count, d[0] + 1, &palette[3 * d[1]]);
+    }
+    else
+    {
+        for (; d < end; d += 3)
+        {
+            np_asset_skip(&c, width, d[0]);
+            if (c.pos >= count)
+                break;
+            np_asset_fill(&c, width, count, d[1], &palette[3 * d[2]]);
+        }
+    }
+    return f[1];
+}
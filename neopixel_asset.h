@@ -0,0 +1,25 @@
+#ifndef NEOPIXEL_ASSET_H
+#define NEOPIXEL_ASSET_H
+
+#include "neopixel_anim.h"
+
+/*
+ * Animações compiladas por np_asset.py (formato descrito lá): paleta, quadros-chave e
+ * quadros delta em RLE, num vetor const que fica na flash.
+ *
+ * O passo decodifica um quadro por vez direto no buffer de trás, lendo o blob em sequência:
+ * a RAM usada é só a do np_player_t (quadro atual e posição no blob), qualquer que seja o
+ * tamanho da animação. Os quadros delta partem do quadro anterior, que npWrite() deixa no
+ * buffer de trás. A animação é desenhada a partir do canto (0, 0) e recortada na tela.
+ */
+
+#define NP_ASSET_HEADER 10 // "NPA" 1, largura, altura, fps, cores, quadros (u16).
+
+#define NP_ASSET_KEY 0
+#define NP_ASSET_DELTA 1
+
+bool npAssetCheck(const uint8_t *asset, size_t size);
+void npAssetStart(np_player_t *p, const uint8_t *asset, uint repeat, uint64_t now);
+uint32_t npAssetStep(np_player_t *p);
+
+#endif
@@ -0,0 +1,250 @@
+#include "neopixel_draw.h"
+#include "neopixel_swar.h"
+
+/**
+ * Preenche a tela inteira com uma cor.
+ */
+void npFill(npColor_t c)
+{
+    for (uint i = 0; i <= LED_COUNT; ++i)
+        leds[i] = c;
+}
+
+/**
+ * Pinta um ponto da tela; fora dela, não faz nada.
+ */
+void npSetPixel(int x, int y, npColor_t c)
+{
+    if ((uint)x < NP_WIDTH && (uint)y < NP_HEIGHT)
+        leds[np_xy[y][x]] = c;
+}
+
+/**
+ * Cor de um ponto da tela no buffer de trás (0 fora dela).
+ */
+npColor_t npGetPixel(int x, int y)
+{
+    if ((uint)x < NP_WIDTH && (uint)y < NP_HEIGHT)
+        return leds[np_xy[y][x]];
+    return 0;
+}
+
+/**
+ * Segmento horizontal de w pontos a partir de (x, y), para a direita.
+ */
+void npHSpan(int x, int y, int w, npColor_t c)
+{
+    if ((uint)y >= NP_HEIGHT)
+        return;
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (w > NP_WIDTH - x)
+        w = NP_WIDTH - x;
+
+    const np_index_t *row = np_xy[y];
+    for (int i = 0; i < w; ++i)
+        leds[row[x + i]] = c;
+}
+
+/**
+ * Segmento vertical de h pontos a partir de (x, y), para cima.
+ */
+void npVSpan(int x, int y, int h, npColor_t c)
+{
+    if ((uint)x >= NP_WIDTH)
+        return;
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (h > NP_HEIGHT - y)
+        h = NP_HEIGHT - y;
+
+    for (int i = 0; i < h; ++i)
+        leds[np_xy[y + i][x]] = c;
+}
+
+/**
+ * Reta de (x0, y0) a (x1, y1), inclusive (Bresenham, só inteiros).
+ */
+void npLine(int x0, int y0, int x1, int y1, npColor_t c)
+{
+    if (y0 == y1)
+    {
+        npHSpan(x0 < x1 ? x0 : x1, y0, (x0 < x1 ? x1 - x0 : x0 - x1) + 1, c);
+        return;
+    }
+    if (x0 == x1)
+    {
+        npVSpan(x0, y0 < y1 ? y0 : y1, (y0 < y1 ? y1 - y0 : y0 - y1) + 1, c);
+        return;
+    }
+
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1, sx = x0 < x1 ? 1 : -1;
+    int dy = y1 > y0 ? y0 - y1 : y1 - y0, sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    while (true)
+    {
+        npSetPixel(x0, y0, c);
+        if (x0 == x1 && y0 == y1)
+            break;
+        int e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/**
+ * Contorno do retângulo de w x h pontos com canto inferior esquerdo em (x, y).
+ */
+void npRect(int x, int y, int w, int h, npColor_t c)
+{
+    if (w <= 0 || h <= 0)
+        return;
+    npHSpan(x, y, w, c);
+    npHSpan(x, y + h - 1, w, c);
+    npVSpan(x, y + 1, h - 2, c);
+    npVSpan(x + w - 1, y + 1, h - 2, c);
+}
+
+/**
+ * Retângulo cheio de w x h pontos com canto inferior esquerdo em (x, y).
+ */
+void npFillRect(int x, int y, int w, int h, npColor_t c)
+{
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (h > NP_HEIGHT - y)
+        h = NP_HEIGHT - y;
+
+    for (int i = 0; i < h; ++i)
+        npHSpan(x, y + i, w, c);
+}
+
+/**
+ * Copia a imagem com canto inferior esquerdo em (x, y); pixels da cor "key" são transparentes.
+ */
+void npBlit(int x, int y, const npSprite_t *s, npColor_t key)
+{
+    // Parte da imagem que cai na tela.
+    int sx0 = x < 0 ? -x : 0, sy0 = y < 0 ? -y : 0;
+    int sx1 = s->width, sy1 = s->height;
+    if (sx1 > NP_WIDTH - x)
+        sx1 = NP_WIDTH - x;
+    if (sy1 > NP_HEIGHT - y)
+        sy1 = NP_HEIGHT - y;
+
+    for (int sy = sy0; sy < sy1; ++sy)
+    {
+        const npColor_t *src = &s->pixels[sy * s->width];
+        const np_index_t *row = np_xy[y + sy];
+        for (int sx = sx0; sx < sx1; ++sx)
+        {
+            npColor_t c = src[sx];
+            if (c != key)
+                leds[row[x + sx]] = c;
+        }
+    }
+}
+
+/**
+ * Desloca a tela (dx, dy) pontos (positivos: para a direita e para cima); o que entra
+ * pelas bordas recebe "fill".
+ *
+ * Percorre as linhas e colunas no sentido do deslocamento, para ler cada origem antes
+ * de sobrescrevê-la. Pontos sem LED valem "fill" como origem e não são escritos como
+ * destino, para o pixel extra não guardar um valor copiado.
+ */
+void npScroll(int dx, int dy, npColor_t fill)
+{
+    if (dx <= -NP_WIDTH || dx >= NP_WIDTH || dy <= -NP_HEIGHT || dy >= NP_HEIGHT)
+    {
+        npFill(fill);
+        return;
+    }
+    leds[LED_COUNT] = fill;
+
+    for (int i = 0; i < NP_HEIGHT; ++i)
+    {
+        int y = dy > 0 ? NP_HEIGHT - 1 - i : i;
+        const np_index_t *row = np_xy[y];
+        int sy = y - dy;
+        int x;
+
+        if (sy < 0 || sy >= NP_HEIGHT)
+        {
+            for (x = 0; x < NP_WIDTH; ++x)
+                leds[row[x]] = fill;
+            continue;
+        }
+
+        const np_index_t *src = np_xy[sy];
+        if (dx > 0)
+        {
+            for (x = NP_WIDTH - 1; x >= dx; --x)
+                if (row[x] != LED_COUNT)
+                    leds[row[x]] = leds[src[x - dx]];
+            for (; x >= 0; --x)
+                leds[row[x]] = fill;
+        }
+        else
+        {
+            for (x = 0; x < NP_WIDTH + dx; ++x)
+                if (row[x] != LED_COUNT)
+                    leds[row[x]] = leds[src[x - dx]];
+            for (; x < NP_WIDTH; ++x)
+                leds[row[x]] = fill;
+        }
+    }
+}
+
+/**
+ * Escala a tela por f/256 (0..256): f < 256 a cada quadro apaga aos poucos.
+ */
+void npFade(uint f)
+{
+    for (uint i = 0; i <= LED_COUNT; ++i)
+        leds[i] = np_scale(leds[i], f);
+}
+
+/**
+ * Soma o quadro src à tela, saturando.
+ */
+void npAdd(const npColor_t *src)
+{
+    for (uint i = 0; i <= LED_COUNT; ++i)
+        leds[i] = np_add(leds[i], src[i]);
+}
+
+/**
+ * Mistura o quadro src sobre a tela com opacidade alpha/256 (0..256).
+ */
+void npBlend(const npColor_t *src, uint alpha)
+{
+    for (uint i = 0; i <= LED_COUNT; ++i)
+        leds[i] = np_blend(src[i], leds[i], alpha);
+}
+
+/**
+ * Fica com o mais claro de cada canal entre a tela e o quadro src.
+ */
+void npMax(const npColor_t *src)
+{
+    for (uint i = 0; i <= LED_COUNT; ++i)
+        leds[i] = np_max(leds[i], src[i]);
+}
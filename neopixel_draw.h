@@ -0,0 +1,37 @@
+#ifndef NEOPIXEL_DRAW_H
+#define NEOPIXEL_DRAW_H
+
+#include "neopixel.h"
+
+/*
+ * Desenho na tela lógica (ver npXY()), sobre o buffer de trás "leds".
+ *
+ * As coordenadas podem sair da tela: tudo é recortado antes dos laços, que só fazem
+ * uma busca em np_xy e um store de palavra por pixel, linha a linha.
+ */
+
+// Imagem em cores da linha (npColor_t), linhas de baixo para cima, como a tela.
+typedef struct
+{
+    uint8_t width, height;
+    const npColor_t *pixels;
+} npSprite_t;
+
+void npFill(npColor_t c);
+void npSetPixel(int x, int y, npColor_t c);
+npColor_t npGetPixel(int x, int y);
+void npHSpan(int x, int y, int w, npColor_t c);
+void npVSpan(int x, int y, int h, npColor_t c);
+void npLine(int x0, int y0, int x1, int y1, npColor_t c);
+void npRect(int x, int y, int w, int h, npColor_t c);
+void npFillRect(int x, int y, int w, int h, npColor_t c);
+void npBlit(int x, int y, const npSprite_t *s, npColor_t key);
+void npScroll(int dx, int dy, npColor_t fill);
+
+// Tela inteira contra outro quadro de LED_COUNT + 1 pixels na ordem da fita (ver neopixel_swar.h).
+void npFade(uint f);
+void npAdd(const npColor_t *src);
+void npBlend(const npColor_t *src, uint alpha);
+void npMax(const npColor_t *src);
+
+#endif
@@ -0,0 +1,294 @@
+// Gerado por neopixel_gamma.py (gama 2.2, 16 níveis). Não edite à mão.
+
+#include "neopixel_gamma.h"
+
+const uint16_t np_gamma_lut[NP_BRIGHTNESS_LEVELS][256] = {
+    { // nível 0
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    },
+    { // nível 1
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+            0,     0,     0,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+            2,     2,     2,     2,     2,     2,     3,     3,     3,     3,     3,     3,     4,     4,     4,     4,
+            4,     4,     5,     5,     5,     5,     6,     6,     6,     6,     6,     7,     7,     7,     8,     8,
+            8,     8,     9,     9,     9,    10,    10,    10,    10,    11,    11,    11,    12,    12,    12,    13,
+           13,    14,    14,    14,    15,    15,    15,    16,    16,    17,    17,    17,    18,    18,    19,    19,
+           20,    20,    21,    21,    22,    22,    22,    23,    23,    24,    24,    25,    25,    26,    27,    27,
+           28,    28,    29,    29,    30,    30,    31,    32,    32,    33,    33,    34,    35,    35,    36,    36,
+           37,    38,    38,    39,    40,    40,    41,    42,    42,    43,    44,    44,    45,    46,    47,    47,
+           48,    49,    49,    50,    51,    52,    53,    53,    54,    55,    56,    56,    57,    58,    59,    60,
+           61,    61,    62,    63,    64,    65,    66,    67,    67,    68,    69,    70,    71,    72,    73,    74,
+           75,    76,    77,    77,    78,    79,    80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+           90,    91,    93,    94,    95,    96,    97,    98,    99,   100,   101,   102,   103,   104,   106,   107,
+          108,   109,   110,   111,   112,   114,   115,   116,   117,   118,   120,   121,   122,   123,   124,   126,
+          127,   128,   129,   131,   132,   133,   135,   136,   137,   138,   140,   141,   142,   144,   145,   146,
+          148,   149,   150,   152,   153,   155,   156,   157,   159,   160,   162,   163,   164,   166,   167,   169,
+    },
+    { // nível 2
+            0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     1,     1,     1,     1,     1,     2,
+            2,     2,     2,     3,     3,     3,     4,     4,     4,     5,     5,     6,     6,     6,     7,     8,
+            8,     9,     9,    10,    10,    11,    12,    12,    13,    14,    15,    15,    16,    17,    18,    19,
+           20,    21,    22,    22,    23,    24,    25,    27,    28,    29,    30,    31,    32,    33,    35,    36,
+           37,    38,    40,    41,    42,    44,    45,    47,    48,    49,    51,    53,    54,    56,    57,    59,
+           61,    62,    64,    66,    67,    69,    71,    73,    75,    77,    78,    80,    82,    84,    86,    88,
+           90,    93,    95,    97,    99,   101,   103,   106,   108,   110,   112,   115,   117,   120,   122,   124,
+          127,   129,   132,   135,   137,   140,   142,   145,   148,   150,   153,   156,   159,   162,   164,   167,
+          170,   173,   176,   179,   182,   185,   188,   191,   195,   198,   201,   204,   207,   211,   214,   217,
+          221,   224,   227,   231,   234,   238,   241,   245,   248,   252,   256,   259,   263,   267,   271,   274,
+          278,   282,   286,   290,   294,   298,   302,   306,   310,   314,   318,   322,   326,   330,   335,   339,
+          343,   347,   352,   356,   360,   365,   369,   374,   378,   383,   387,   392,   397,   401,   406,   411,
+          415,   420,   425,   430,   435,   440,   445,   450,   454,   460,   465,   470,   475,   480,   485,   490,
+          495,   501,   506,   511,   517,   522,   527,   533,   538,   544,   549,   555,   561,   566,   572,   577,
+          583,   589,   595,   601,   606,   612,   618,   624,   630,   636,   642,   648,   654,   660,   666,   673,
+          679,   685,   691,   698,   704,   710,   717,   723,   730,   736,   743,   749,   756,   762,   769,   776,
+    },
+    { // nível 3
+            0,     0,     0,     0,     0,     0,     0,     1,     1,     1,     2,     2,     2,     3,     3,     4,
+            4,     5,     6,     6,     7,     8,     9,    10,    10,    11,    12,    14,    15,    16,    17,    18,
+           20,    21,    22,    24,    25,    27,    29,    30,    32,    34,    36,    38,    40,    42,    44,    46,
+           48,    50,    53,    55,    57,    60,    62,    65,    67,    70,    73,    76,    78,    81,    84,    87,
+           90,    94,    97,   100,   103,   107,   110,   114,   117,   121,   124,   128,   132,   136,   140,   144,
+          148,   152,   156,   160,   164,   169,   173,   178,   182,   187,   191,   196,   201,   206,   211,   216,
+          221,   226,   231,   236,   241,   247,   252,   258,   263,   269,   274,   280,   286,   292,   298,   304,
+          310,   316,   322,   328,   335,   341,   347,   354,   360,   367,   374,   381,   387,   394,   401,   408,
+          415,   423,   430,   437,   445,   452,   460,   467,   475,   482,   490,   498,   506,   514,   522,   530,
+          538,   547,   555,   563,   572,   580,   589,   598,   606,   615,   624,   633,   642,   651,   660,   669,
+          679,   688,   698,   707,   717,   726,   736,   746,   756,   766,   776,   786,   796,   806,   816,   827,
+          837,   848,   858,   869,   880,   890,   901,   912,   923,   934,   945,   957,   968,   979,   991,  1002,
+         1014,  1025,  1037,  1049,  1061,  1073,  1085,  1097,  1109,  1121,  1134,  1146,  1158,  1171,  1183,  1196,
+         1209,  1222,  1235,  1248,  1261,  1274,  1287,  1300,  1314,  1327,  1340,  1354,  1368,  1381,  1395,  1409,
+         1423,  1437,  1451,  1465,  1479,  1494,  1508,  1523,  1537,  1552,  1567,  1581,  1596,  1611,  1626,  1641,
+         1656,  1671,  1687,  1702,  1718,  1733,  1749,  1764,  1780,  1796,  1812,  1828,  1844,  1860,  1876,  1893,
+    },
+    { // nível 4
+            0,     0,     0,     0,     0,     1,     1,     1,     2,     2,     3,     4,     4,     5,     6,     7,
+            8,     9,    10,    12,    13,    15,    16,    18,    20,    22,    23,    25,    28,    30,    32,    35,
+           37,    40,    42,    45,    48,    51,    54,    57,    61,    64,    67,    71,    75,    78,    82,    86,
+           90,    95,    99,   103,   108,   112,   117,   122,   127,   132,   137,   142,   148,   153,   159,   164,
+          170,   176,   182,   188,   195,   201,   207,   214,   221,   227,   234,   241,   248,   256,   263,   271,
+          278,   286,   294,   302,   310,   318,   326,   335,   343,   352,   360,   369,   378,   387,   397,   406,
+          415,   425,   435,   445,   454,   465,   475,   485,   495,   506,   517,   527,   538,   549,   561,   572,
+          583,   595,   606,   618,   630,   642,   654,   666,   679,   691,   704,   717,   730,   743,   756,   769,
+          782,   796,   809,   823,   837,   851,   865,   880,   894,   908,   923,   938,   953,   968,   983,   998,
+         1014,  1029,  1045,  1061,  1077,  1093,  1109,  1125,  1142,  1158,  1175,  1192,  1209,  1226,  1243,  1261,
+         1278,  1296,  1314,  1331,  1350,  1368,  1386,  1404,  1423,  1442,  1461,  1479,  1499,  1518,  1537,  1557,
+         1576,  1596,  1616,  1636,  1656,  1677,  1697,  1718,  1738,  1759,  1780,  1801,  1823,  1844,  1865,  1887,
+         1909,  1931,  1953,  1975,  1997,  2020,  2043,  2065,  2088,  2111,  2134,  2158,  2181,  2205,  2229,  2252,
+         2276,  2301,  2325,  2349,  2374,  2399,  2423,  2448,  2474,  2499,  2524,  2550,  2575,  2601,  2627,  2653,
+         2680,  2706,  2733,  2759,  2786,  2813,  2840,  2867,  2895,  2922,  2950,  2978,  3006,  3034,  3062,  3090,
+         3119,  3147,  3176,  3205,  3234,  3264,  3293,  3322,  3352,  3382,  3412,  3442,  3472,  3503,  3533,  3564,
+    },
+    { // nível 5
+            0,     0,     0,     0,     1,     1,     2,     2,     3,     4,     5,     6,     7,     8,    10,    11,
+           13,    15,    17,    19,    22,    24,    27,    29,    32,    35,    38,    42,    45,    49,    53,    56,
+           61,    65,    69,    74,    78,    83,    88,    94,    99,   104,   110,   116,   122,   128,   135,   141,
+          148,   155,   162,   169,   176,   184,   191,   199,   207,   216,   224,   233,   241,   250,   259,   269,
+          278,   288,   298,   308,   318,   328,   339,   350,   360,   372,   383,   394,   406,   418,   430,   442,
+          454,   467,   480,   493,   506,   519,   533,   547,   561,   575,   589,   603,   618,   633,   648,   663,
+          679,   694,   710,   726,   743,   759,   776,   792,   809,   827,   844,   862,   880,   898,   916,   934,
+          953,   972,   991,  1010,  1029,  1049,  1069,  1089,  1109,  1129,  1150,  1171,  1192,  1213,  1235,  1256,
+         1278,  1300,  1323,  1345,  1368,  1391,  1414,  1437,  1461,  1484,  1508,  1532,  1557,  1581,  1606,  1631,
+         1656,  1682,  1707,  1733,  1759,  1785,  1812,  1839,  1865,  1893,  1920,  1947,  1975,  2003,  2031,  2060,
+         2088,  2117,  2146,  2175,  2205,  2235,  2264,  2295,  2325,  2355,  2386,  2417,  2448,  2480,  2512,  2543,
+         2575,  2608,  2640,  2673,  2706,  2739,  2773,  2806,  2840,  2874,  2908,  2943,  2978,  3013,  3048,  3083,
+         3119,  3155,  3191,  3227,  3264,  3300,  3337,  3374,  3412,  3450,  3487,  3525,  3564,  3602,  3641,  3680,
+         3719,  3759,  3798,  3838,  3879,  3919,  3959,  4000,  4041,  4083,  4124,  4166,  4208,  4250,  4292,  4335,
+         4378,  4421,  4464,  4508,  4552,  4596,  4640,  4685,  4729,  4774,  4819,  4865,  4911,  4956,  5003,  5049,
+         5096,  5142,  5189,  5237,  5284,  5332,  5380,  5428,  5477,  5525,  5574,  5624,  5673,  5723,  5772,  5823,
+    },
+    { // nível 6
+            0,     0,     0,     0,     1,     2,     2,     3,     4,     6,     7,     9,    10,    12,    15,    17,
+           20,    22,    25,    29,    32,    36,    40,    44,    48,    53,    57,    62,    67,    73,    78,    84,
+           90,    97,   103,   110,   117,   124,   132,   140,   148,   156,   164,   173,   182,   191,   201,   211,
+          221,   231,   241,   252,   263,   274,   286,   298,   310,   322,   335,   347,   360,   374,   387,   401,
+          415,   430,   445,   460,   475,   490,   506,   522,   538,   555,   572,   589,   606,   624,   642,   660,
+          679,   698,   717,   736,   756,   776,   796,   816,   837,   858,   880,   901,   923,   945,   968,   991,
+         1014,  1037,  1061,  1085,  1109,  1134,  1158,  1183,  1209,  1235,  1261,  1287,  1314,  1340,  1368,  1395,
+         1423,  1451,  1479,  1508,  1537,  1567,  1596,  1626,  1656,  1687,  1718,  1749,  1780,  1812,  1844,  1876,
+         1909,  1942,  1975,  2009,  2043,  2077,  2111,  2146,  2181,  2217,  2252,  2289,  2325,  2362,  2399,  2436,
+         2474,  2512,  2550,  2588,  2627,  2666,  2706,  2746,  2786,  2826,  2867,  2908,  2950,  2992,  3034,  3076,
+         3119,  3162,  3205,  3249,  3293,  3337,  3382,  3427,  3472,  3518,  3564,  3610,  3657,  3704,  3751,  3798,
+         3846,  3895,  3943,  3992,  4041,  4091,  4141,  4191,  4242,  4292,  4344,  4395,  4447,  4499,  4552,  4605,
+         4658,  4711,  4765,  4819,  4874,  4929,  4984,  5040,  5096,  5152,  5208,  5265,  5322,  5380,  5438,  5496,
+         5555,  5614,  5673,  5733,  5792,  5853,  5913,  5974,  6036,  6097,  6159,  6222,  6284,  6347,  6411,  6474,
+         6538,  6603,  6667,  6733,  6798,  6864,  6930,  6996,  7063,  7130,  7198,  7266,  7334,  7402,  7471,  7540,
+         7610,  7680,  7750,  7821,  7892,  7963,  8035,  8107,  8179,  8252,  8325,  8399,  8472,  8547,  8621,  8696,
+    },
+    { // nível 7
+            0,     0,     0,     1,     1,     2,     3,     4,     6,     8,    10,    12,    15,    17,    21,    24,
+           28,    32,    36,    40,    45,    50,    56,    61,    67,    74,    80,    87,    95,   102,   110,   118,
+          127,   136,   145,   155,   164,   175,   185,   196,   207,   219,   231,   243,   256,   269,   282,   296,
+          310,   324,   339,   354,   369,   385,   401,   418,   435,   452,   470,   488,   506,   525,   544,   563,
+          583,   603,   624,   645,   666,   688,   710,   733,   756,   779,   803,   827,   851,   876,   901,   927,
+          953,   979,  1006,  1033,  1061,  1089,  1117,  1146,  1175,  1205,  1235,  1265,  1296,  1327,  1359,  1391,
+         1423,  1456,  1489,  1523,  1557,  1591,  1626,  1661,  1697,  1733,  1770,  1807,  1844,  1882,  1920,  1958,
+         1997,  2037,  2077,  2117,  2158,  2199,  2241,  2282,  2325,  2368,  2411,  2455,  2499,  2543,  2588,  2634,
+         2680,  2726,  2773,  2820,  2867,  2915,  2964,  3013,  3062,  3112,  3162,  3212,  3264,  3315,  3367,  3419,
+         3472,  3525,  3579,  3633,  3688,  3743,  3798,  3854,  3911,  3968,  4025,  4083,  4141,  4199,  4258,  4318,
+         4378,  4438,  4499,  4561,  4622,  4685,  4747,  4810,  4874,  4938,  5003,  5068,  5133,  5199,  5265,  5332,
+         5399,  5467,  5535,  5604,  5673,  5742,  5813,  5883,  5954,  6025,  6097,  6170,  6242,  6316,  6389,  6464,
+         6538,  6614,  6689,  6765,  6842,  6919,  6996,  7074,  7153,  7232,  7311,  7391,  7471,  7552,  7633,  7715,
+         7797,  7880,  7963,  8047,  8131,  8216,  8301,  8386,  8472,  8559,  8646,  8733,  8821,  8910,  8999,  9088,
+         9178,  9268,  9359,  9451,  9543,  9635,  9728,  9821,  9915, 10009, 10104, 10199, 10295, 10391, 10488, 10585,
+        10682, 10781, 10879, 10978, 11078, 11178, 11279, 11380, 11482, 11584, 11686, 11789, 11893, 11997, 12102, 12207,
+    },
+    { // nível 8
+            0,     0,     0,     1,     2,     3,     4,     6,     8,    10,    13,    16,    20,    23,    28,    32,
+           37,    42,    48,    54,    61,    67,    75,    82,    90,    99,   108,   117,   127,   137,   148,   159,
+          170,   182,   195,   207,   221,   234,   248,   263,   278,   294,   310,   326,   343,   360,   378,   397,
+          415,   435,   454,   475,   495,   517,   538,   561,   583,   606,   630,   654,   679,   704,   730,   756,
+          782,   809,   837,   865,   894,   923,   953,   983,  1014,  1045,  1077,  1109,  1142,  1175,  1209,  1243,
+         1278,  1314,  1350,  1386,  1423,  1461,  1499,  1537,  1576,  1616,  1656,  1697,  1738,  1780,  1823,  1865,
+         1909,  1953,  1997,  2043,  2088,  2134,  2181,  2229,  2276,  2325,  2374,  2423,  2474,  2524,  2575,  2627,
+         2680,  2733,  2786,  2840,  2895,  2950,  3006,  3062,  3119,  3176,  3234,  3293,  3352,  3412,  3472,  3533,
+         3595,  3657,  3719,  3783,  3846,  3911,  3976,  4041,  4107,  4174,  4242,  4309,  4378,  4447,  4517,  4587,
+         4658,  4729,  4801,  4874,  4947,  5021,  5096,  5171,  5246,  5322,  5399,  5477,  5555,  5633,  5713,  5792,
+         5873,  5954,  6036,  6118,  6201,  6284,  6368,  6453,  6538,  6624,  6711,  6798,  6886,  6974,  7063,  7153,
+         7243,  7334,  7425,  7517,  7610,  7703,  7797,  7892,  7987,  8083,  8179,  8276,  8374,  8472,  8571,  8671,
+         8771,  8872,  8973,  9075,  9178,  9281,  9385,  9490,  9595,  9701,  9808,  9915, 10022, 10131, 10240, 10350,
+        10460, 10571, 10682, 10795, 10908, 11021, 11135, 11250, 11365, 11482, 11598, 11716, 11834, 11952, 12072, 12192,
+        12312, 12433, 12555, 12678, 12801, 12925, 13049, 13175, 13300, 13427, 13554, 13682, 13810, 13939, 14069, 14199,
+        14330, 14462, 14594, 14727, 14861, 14995, 15130, 15266, 15402, 15539, 15677, 15815, 15954, 16094, 16234, 16375,
+    },
+    { // nível 9
+            0,     0,     0,     1,     2,     4,     6,     8,    10,    14,    17,    21,    25,    30,    36,    42,
+           48,    55,    62,    70,    78,    87,    97,   107,   117,   128,   140,   152,   164,   178,   191,   206,
+          221,   236,   252,   269,   286,   304,   322,   341,   360,   381,   401,   423,   445,   467,   490,   514,
+          538,   563,   589,   615,   642,   669,   698,   726,   756,   786,   816,   848,   880,   912,   945,   979,
+         1014,  1049,  1085,  1121,  1158,  1196,  1235,  1274,  1314,  1354,  1395,  1437,  1479,  1523,  1567,  1611,
+         1656,  1702,  1749,  1796,  1844,  1893,  1942,  1992,  2043,  2094,  2146,  2199,  2252,  2307,  2362,  2417,
+         2474,  2531,  2588,  2647,  2706,  2766,  2826,  2888,  2950,  3013,  3076,  3140,  3205,  3271,  3337,  3404,
+         3472,  3541,  3610,  3680,  3751,  3822,  3895,  3968,  4041,  4116,  4191,  4267,  4344,  4421,  4499,  4578,
+         4658,  4738,  4819,  4901,  4984,  5068,  5152,  5237,  5322,  5409,  5496,  5584,  5673,  5762,  5853,  5944,
+         6036,  6128,  6222,  6316,  6411,  6506,  6603,  6700,  6798,  6897,  6996,  7097,  7198,  7300,  7402,  7506,
+         7610,  7715,  7821,  7928,  8035,  8143,  8252,  8362,  8472,  8584,  8696,  8809,  8923,  9037,  9152,  9268,
+         9385,  9503,  9622,  9741,  9861,  9982, 10104, 10226, 10350, 10474, 10599, 10724, 10851, 10978, 11107, 11236,
+        11365, 11496, 11628, 11760, 11893, 12027, 12162, 12297, 12433, 12571, 12709, 12847, 12987, 13128, 13269, 13411,
+        13554, 13698, 13842, 13988, 14134, 14281, 14429, 14578, 14727, 14878, 15029, 15181, 15334, 15488, 15642, 15798,
+        15954, 16111, 16269, 16428, 16588, 16748, 16909, 17071, 17234, 17398, 17563, 17729, 17895, 18062, 18230, 18399,
+        18569, 18740, 18911, 19084, 19257, 19431, 19606, 19781, 19958, 20136, 20314, 20493, 20673, 20854, 21036, 21218,
+    },
+    { // nível 10
+            0,     0,     1,     2,     3,     5,     7,    10,    13,    17,    22,    27,    32,    38,    45,    53,
+           61,    69,    78,    88,    99,   110,   122,   135,   148,   162,   176,   191,   207,   224,   241,   259,
+          278,   298,   318,   339,   360,   383,   406,   430,   454,   480,   506,   533,   561,   589,   618,   648,
+          679,   710,   743,   776,   809,   844,   880,   916,   953,   991,  1029,  1069,  1109,  1150,  1192,  1235,
+         1278,  1323,  1368,  1414,  1461,  1508,  1557,  1606,  1656,  1707,  1759,  1812,  1865,  1920,  1975,  2031,
+         2088,  2146,  2205,  2264,  2325,  2386,  2448,  2512,  2575,  2640,  2706,  2773,  2840,  2908,  2978,  3048,
+         3119,  3191,  3264,  3337,  3412,  3487,  3564,  3641,  3719,  3798,  3879,  3959,  4041,  4124,  4208,  4292,
+         4378,  4464,  4552,  4640,  4729,  4819,  4911,  5003,  5096,  5189,  5284,  5380,  5477,  5574,  5673,  5772,
+         5873,  5974,  6077,  6180,  6284,  6389,  6496,  6603,  6711,  6820,  6930,  7041,  7153,  7266,  7379,  7494,
+         7610,  7727,  7845,  7963,  8083,  8204,  8325,  8448,  8571,  8696,  8821,  8948,  9075,  9204,  9333,  9464,
+         9595,  9728,  9861,  9995, 10131, 10267, 10405, 10543, 10682, 10823, 10964, 11107, 11250, 11394, 11540, 11686,
+        11834, 11982, 12132, 12282, 12433, 12586, 12739, 12894, 13049, 13206, 13363, 13522, 13682, 13842, 14004, 14167,
+        14330, 14495, 14661, 14827, 14995, 15164, 15334, 15505, 15677, 15850, 16024, 16199, 16375, 16552, 16730, 16909,
+        17090, 17271, 17453, 17636, 17821, 18006, 18193, 18380, 18569, 18759, 18949, 19141, 19334, 19528, 19723, 19919,
+        20116, 20314, 20513, 20713, 20915, 21117, 21320, 21525, 21730, 21937, 22144, 22353, 22563, 22774, 22986, 23199,
+        23413, 23628, 23844, 24062, 24280, 24499, 24720, 24942, 25164, 25388, 25613, 25839, 26066, 26294, 26523, 26753,
+    },
+    { // nível 11
+            0,     0,     1,     2,     4,     6,     9,    12,    16,    21,    27,    33,    40,    47,    56,    65,
+           75,    85,    97,   109,   122,   136,   150,   166,   182,   199,   217,   236,   256,   276,   298,   320,
+          343,   367,   392,   418,   445,   472,   501,   530,   561,   592,   624,   657,   691,   726,   762,   799,
+          837,   876,   916,   957,   998,  1041,  1085,  1129,  1175,  1222,  1269,  1318,  1368,  1418,  1470,  1523,
+         1576,  1631,  1687,  1743,  1801,  1860,  1920,  1981,  2043,  2106,  2170,  2235,  2301,  2368,  2436,  2505,
+         2575,  2647,  2719,  2793,  2867,  2943,  3020,  3097,  3176,  3256,  3337,  3419,  3503,  3587,  3672,  3759,
+         3846,  3935,  4025,  4116,  4208,  4301,  4395,  4491,  4587,  4685,  4783,  4883,  4984,  5086,  5189,  5294,
+         5399,  5506,  5614,  5723,  5833,  5944,  6056,  6170,  6284,  6400,  6517,  6635,  6754,  6875,  6996,  7119,
+         7243,  7368,  7494,  7622,  7750,  7880,  8011,  8143,  8276,  8411,  8547,  8683,  8821,  8961,  9101,  9243,
+         9385,  9529,  9675,  9821,  9969, 10117, 10267, 10418, 10571, 10724, 10879, 11035, 11193, 11351, 11511, 11672,
+        11834, 11997, 12162, 12327, 12494, 12663, 12832, 13003, 13175, 13348, 13522, 13698, 13875, 14053, 14232, 14412,
+        14594, 14777, 14962, 15147, 15334, 15522, 15711, 15902, 16094, 16287, 16481, 16677, 16873, 17071, 17271, 17471,
+        17673, 17876, 18081, 18287, 18493, 18702, 18911, 19122, 19334, 19547, 19762, 19978, 20195, 20413, 20633, 20854,
+        21076, 21300, 21525, 21751, 21978, 22207, 22437, 22668, 22901, 23135, 23370, 23607, 23844, 24083, 24324, 24565,
+        24809, 25053, 25298, 25545, 25794, 26043, 26294, 26546, 26800, 27054, 27311, 27568, 27827, 28087, 28348, 28611,
+        28875, 29140, 29407, 29675, 29944, 30215, 30487, 30760, 31035, 31311, 31588, 31867, 32147, 32428, 32711, 32995,
+    },
+    { // nível 12
+            0,     0,     1,     2,     4,     7,    10,    15,    20,    25,    32,    40,    48,    57,    67,    78,
+           90,   103,   117,   132,   148,   164,   182,   201,   221,   241,   263,   286,   310,   335,   360,   387,
+          415,   445,   475,   506,   538,   572,   606,   642,   679,   717,   756,   796,   837,   880,   923,   968,
+         1014,  1061,  1109,  1158,  1209,  1261,  1314,  1368,  1423,  1479,  1537,  1596,  1656,  1718,  1780,  1844,
+         1909,  1975,  2043,  2111,  2181,  2252,  2325,  2399,  2474,  2550,  2627,  2706,  2786,  2867,  2950,  3034,
+         3119,  3205,  3293,  3382,  3472,  3564,  3657,  3751,  3846,  3943,  4041,  4141,  4242,  4344,  4447,  4552,
+         4658,  4765,  4874,  4984,  5096,  5208,  5322,  5438,  5555,  5673,  5792,  5913,  6036,  6159,  6284,  6411,
+         6538,  6667,  6798,  6930,  7063,  7198,  7334,  7471,  7610,  7750,  7892,  8035,  8179,  8325,  8472,  8621,
+         8771,  8923,  9075,  9230,  9385,  9543,  9701,  9861, 10022, 10185, 10350, 10515, 10682, 10851, 11021, 11193,
+        11365, 11540, 11716, 11893, 12072, 12252, 12433, 12617, 12801, 12987, 13175, 13363, 13554, 13746, 13939, 14134,
+        14330, 14528, 14727, 14928, 15130, 15334, 15539, 15746, 15954, 16164, 16375, 16588, 16802, 17017, 17234, 17453,
+        17673, 17895, 18118, 18343, 18569, 18797, 19026, 19257, 19489, 19723, 19958, 20195, 20433, 20673, 20915, 21157,
+        21402, 21648, 21895, 22144, 22395, 22647, 22901, 23156, 23413, 23671, 23931, 24193, 24455, 24720, 24986, 25254,
+        25523, 25794, 26066, 26340, 26615, 26892, 27171, 27451, 27732, 28016, 28300, 28587, 28875, 29164, 29455, 29748,
+        30042, 30338, 30636, 30935, 31235, 31538, 31841, 32147, 32454, 32762, 33072, 33384, 33697, 34012, 34329, 34647,
+        34967, 35288, 35611, 35935, 36262, 36589, 36919, 37250, 37582, 37917, 38252, 38590, 38929, 39269, 39612, 39956,
+    },
+    { // nível 13
+            0,     0,     1,     3,     5,     8,    12,    17,    23,    30,    38,    47,    57,    68,    80,    94,
+          108,   123,   140,   157,   176,   196,   217,   240,   263,   288,   314,   341,   369,   399,   430,   462,
+          495,   530,   566,   603,   642,   682,   723,   766,   809,   855,   901,   949,   998,  1049,  1101,  1154,
+         1209,  1265,  1323,  1381,  1442,  1503,  1567,  1631,  1697,  1764,  1833,  1903,  1975,  2048,  2123,  2199,
+         2276,  2355,  2436,  2518,  2601,  2686,  2773,  2860,  2950,  3041,  3133,  3227,  3322,  3419,  3518,  3618,
+         3719,  3822,  3927,  4033,  4141,  4250,  4361,  4473,  4587,  4702,  4819,  4938,  5058,  5180,  5303,  5428,
+         5555,  5683,  5813,  5944,  6077,  6211,  6347,  6485,  6624,  6765,  6908,  7052,  7198,  7345,  7494,  7645,
+         7797,  7951,  8107,  8264,  8423,  8584,  8746,  8910,  9075,  9243,  9411,  9582,  9754,  9928, 10104, 10281,
+        10460, 10641, 10823, 11007, 11193, 11380, 11569, 11760, 11952, 12147, 12342, 12540, 12739, 12940, 13143, 13348,
+        13554, 13762, 13971, 14183, 14396, 14611, 14827, 15046, 15266, 15488, 15711, 15937, 16164, 16393, 16623, 16855,
+        17090, 17325, 17563, 17802, 18044, 18287, 18531, 18778, 19026, 19276, 19528, 19781, 20037, 20294, 20553, 20814,
+        21076, 21341, 21607, 21875, 22144, 22416, 22689, 22965, 23242, 23520, 23801, 24083, 24368, 24654, 24942, 25231,
+        25523, 25816, 26111, 26408, 26707, 27008, 27311, 27615, 27921, 28229, 28539, 28851, 29164, 29480, 29797, 30116,
+        30437, 30760, 31085, 31411, 31740, 32070, 32402, 32736, 33072, 33410, 33750, 34091, 34435, 34780, 35127, 35476,
+        35827, 36180, 36535, 36891, 37250, 37610, 37972, 38337, 38703, 39071, 39440, 39812, 40186, 40561, 40939, 41318,
+        41700, 42083, 42468, 42855, 43244, 43635, 44027, 44422, 44819, 45217, 45618, 46020, 46425, 46831, 47239, 47649,
+    },
+    { // nível 14
+            0,     0,     1,     3,     6,    10,    15,    21,    28,    36,    45,    56,    67,    80,    95,   110,
+          127,   145,   164,   185,   207,   231,   256,   282,   310,   339,   369,   401,   435,   470,   506,   544,
+          583,   624,   666,   710,   756,   803,   851,   901,   953,  1006,  1061,  1117,  1175,  1235,  1296,  1359,
+         1423,  1489,  1557,  1626,  1697,  1770,  1844,  1920,  1997,  2077,  2158,  2241,  2325,  2411,  2499,  2588,
+         2680,  2773,  2867,  2964,  3062,  3162,  3264,  3367,  3472,  3579,  3688,  3798,  3911,  4025,  4141,  4258,
+         4378,  4499,  4622,  4747,  4874,  5003,  5133,  5265,  5399,  5535,  5673,  5813,  5954,  6097,  6242,  6389,
+         6538,  6689,  6842,  6996,  7153,  7311,  7471,  7633,  7797,  7963,  8131,  8301,  8472,  8646,  8821,  8999,
+         9178,  9359,  9543,  9728,  9915, 10104, 10295, 10488, 10682, 10879, 11078, 11279, 11482, 11686, 11893, 12102,
+        12312, 12525, 12739, 12956, 13175, 13395, 13618, 13842, 14069, 14297, 14528, 14761, 14995, 15232, 15471, 15711,
+        15954, 16199, 16446, 16694, 16945, 17198, 17453, 17710, 17969, 18230, 18493, 18759, 19026, 19295, 19567, 19840,
+        20116, 20393, 20673, 20955, 21239, 21525, 21813, 22103, 22395, 22689, 22986, 23284, 23585, 23888, 24193, 24499,
+        24809, 25120, 25433, 25748, 26066, 26386, 26707, 27031, 27357, 27685, 28016, 28348, 28683, 29019, 29358, 29699,
+        30042, 30388, 30735, 31085, 31437, 31791, 32147, 32505, 32865, 33228, 33593, 33960, 34329, 34700, 35074, 35449,
+        35827, 36207, 36589, 36974, 37360, 37749, 38140, 38533, 38929, 39326, 39726, 40128, 40532, 40939, 41347, 41758,
+        42171, 42587, 43004, 43424, 43846, 44270, 44697, 45125, 45556, 45989, 46425, 46862, 47302, 47744, 48188, 48635,
+        49084, 49535, 49988, 50444, 50901, 51362, 51824, 52288, 52755, 53224, 53696, 54170, 54645, 55124, 55604, 56087,
+    },
+    { // nível 15
+            0,     0,     2,     4,     7,    11,    17,    24,    32,    42,    53,    65,    78,    94,   110,   128,
+          148,   169,   191,   216,   241,   269,   298,   328,   360,   394,   430,   467,   506,   547,   589,   633,
+          679,   726,   776,   827,   880,   934,   991,  1049,  1109,  1171,  1235,  1300,  1368,  1437,  1508,  1581,
+         1656,  1733,  1812,  1893,  1975,  2060,  2146,  2235,  2325,  2417,  2512,  2608,  2706,  2806,  2908,  3013,
+         3119,  3227,  3337,  3450,  3564,  3680,  3798,  3919,  4041,  4166,  4292,  4421,  4552,  4685,  4819,  4956,
+         5096,  5237,  5380,  5525,  5673,  5823,  5974,  6128,  6284,  6442,  6603,  6765,  6930,  7097,  7266,  7437,
+         7610,  7786,  7963,  8143,  8325,  8509,  8696,  8885,  9075,  9268,  9464,  9661,  9861, 10063, 10267, 10474,
+        10682, 10893, 11107, 11322, 11540, 11760, 11982, 12207, 12433, 12663, 12894, 13128, 13363, 13602, 13842, 14085,
+        14330, 14578, 14827, 15080, 15334, 15591, 15850, 16111, 16375, 16641, 16909, 17180, 17453, 17729, 18006, 18287,
+        18569, 18854, 19141, 19431, 19723, 20017, 20314, 20613, 20915, 21218, 21525, 21833, 22144, 22458, 22774, 23092,
+        23413, 23736, 24062, 24390, 24720, 25053, 25388, 25726, 26066, 26408, 26753, 27101, 27451, 27803, 28158, 28515,
+        28875, 29237, 29602, 29969, 30338, 30710, 31085, 31462, 31841, 32223, 32608, 32995, 33384, 33776, 34170, 34567,
+        34967, 35369, 35773, 36180, 36589, 37001, 37416, 37833, 38252, 38674, 39099, 39526, 39956, 40388, 40823, 41260,
+        41700, 42142, 42587, 43034, 43484, 43937, 44392, 44849, 45310, 45772, 46238, 46706, 47176, 47649, 48125, 48603,
+        49084, 49567, 50053, 50542, 51033, 51526, 52023, 52522, 53023, 53527, 54034, 54543, 55055, 55570, 56087, 56607,
+        57129, 57654, 58182, 58712, 59245, 59780, 60318, 60859, 61402, 61948, 62497, 63048, 63602, 64159, 64718, 65280,
+    },
+};
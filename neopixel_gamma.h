@@ -0,0 +1,37 @@
+#ifndef NEOPIXEL_GAMMA_H
+#define NEOPIXEL_GAMMA_H
+
+#include "pico/stdlib.h"
+
+/*
+ * Correção de gama e brilho global, aplicadas só na codificação do quadro para a linha.
+ *
+ * As animações desenham cores em escala cheia (0..255, perceptual); a tabela ativa leva
+ * cada canal ao valor de PWM do LED, em 8.8 bits (a fração alimenta o pontilhamento
+ * temporal, ver npSetDither()). As tabelas são geradas por neopixel_gamma.py, uma por
+ * nível de brilho: trocar o brilho é trocar o ponteiro, sem refazer nenhum cálculo.
+ */
+
+#define NP_GAMMA 2.2
+#define NP_BRIGHTNESS_LEVELS 16
+#define NP_BRIGHTNESS_DEFAULT 7 // ~19% da luz máxima: a matriz 5x5 ofusca em brilho cheio.
+
+// Bits da fração usados pelo pontilhamento. Com 4, o pior caso repete a cada 16 quadros
+// (~55 Hz na matriz 5x5), ainda sem cintilação visível; com 8 seria a cada 256.
+#define NP_DITHER_BITS 4
+
+extern const uint16_t np_gamma_lut[NP_BRIGHTNESS_LEVELS][256];
+
+// Tabela do brilho atual (lida pelos codificadores de neopixel.c e neopixel_parallel.c).
+extern const uint16_t *volatile np_lut;
+
+// Canal sem pontilhamento: arredonda a saída 8.8 da tabela para o passo do PWM.
+static inline uint8_t np_lut8(const uint16_t *lut, uint8_t v)
+{
+    return (lut[v] + 128) >> 8;
+}
+
+void npSetBrightness(uint level);
+uint npGetBrightness(void);
+
+#endif
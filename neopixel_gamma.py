@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+"""Gera neopixel_gamma.c: uma tabela de 256 entradas por nível de brilho.
+
+Cada tabela leva o valor de 8 bits das animações (perceptual) ao PWM do WS2812, em
+16 bits (8.8: passo do PWM e fração, consumida pelo pontilhamento temporal):
+    saida = round(255 * 256 * (entrada / 255 * nivel / (NIVEIS - 1)) ** GAMMA)
+
+Uso: python3 neopixel_gamma.py [neopixel_gamma.c]
+Os valores de GAMMA e NIVEIS devem bater com NP_GAMMA e NP_BRIGHTNESS_LEVELS em neopixel_gamma.h.
+"""
+
+import sys
+
+GAMMA = 2.2
+LEVELS = 16
+
+
+def table(level):
+    scale = level / (LEVELS - 1)
+    return [round(255 * 256 * (v / 255 * scale) ** GAMMA) for v in range(256)]
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else "neopixel_gamma.c"
+    out = [
+        "// Gerado por neopixel_gamma.py (gama %.1f, %d níveis). Não edite à mão." % (GAMMA, LEVELS),
+        "",
+        '#include "neopixel_gamma.h"',
+        "",
+        "const uint16_t np_gamma_lut[NP_BRIGHTNESS_LEVELS][256] = {",
+    ]
+    for level in range(LEVELS):
+        values = table(level)
+        out.append("    { // nível %d" % level)
+        for i in range(0, 256, 16):
+            out.append("        " + ", ".join("%5d" % v for v in values[i:i + 16]) + ",")
+        out.append("    },")
+    out.append("};")
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Gera neopixel_layout.h e neopixel_layout.c: dimensões da tela lógica e a tabela
+(x, y) -> índice na fita, declarada no .h e definida uma vez só no .c.
+
+A tela é formada por um ou mais painéis encadeados na mesma fita, na ordem dada. Cada
+painel é descrito por "LxA+X+Y[:ligação[:rotação]]":
+    LxA       LEDs por linha e linhas do painel, como ligado
+    +X+Y      canto inferior esquerdo do painel na tela
+    ligação   serpentine (padrão: linhas alternam de sentido) ou progressive (todas
+              da esquerda para a direita)
+    rotação   0 (padrão), 90, 180 ou 270 graus, anti-horário, do painel na tela
+Ex.: "8x8+0+0" "8x8+8+0:progressive" "5x5+16+0:serpentine:90".
+
+A tela lógica inteira ainda pode ser girada e espelhada. Pontos da tela sem LED (painéis
+de tamanhos diferentes) apontam para NP_LED_COUNT, um pixel a mais no fim dos buffers que
+nunca é enviado: o desenho só indexa np_xy[y][x], sem divisão, resto, desvio ou teste.
+
+Uso: python3 neopixel_layout.py [--rotation 0] [--mirror] -o neopixel_layout.h PAINEL...
+O .c é escrito ao lado do .h, com o mesmo nome.
+"""
+
+import argparse
+import os
+import re
+
+
+def rotate(x, y, width, height, rotation):
+    # (x, y) de uma área girada no sentido anti-horário -> (x, y) na área original, de
+    # width x height. Com (0, 0) embaixo à esquerda, 90 leva o canto de baixo à esquerda
+    # da original para baixo à direita.
+    return {
+        0: (x, y),
+        90: (y, height - 1 - x),
+        180: (width - 1 - x, height - 1 - y),
+        270: (width - 1 - y, x),
+    }[rotation]
+
+
+def rotated_size(width, height, rotation):
+    return (height, width) if rotation in (90, 270) else (width, height)
+
+
+class Panel:
+    SPEC = re.compile(r"^(\d+)x(\d+)\+(\d+)\+(\d+)(?::(serpentine|progressive))?(?::(0|90|180|270))?$")
+
+    def __init__(self, spec, first):
+        m = self.SPEC.match(spec)
+        if not m:
+            raise SystemExit("painel inválido: %r (esperado LxA+X+Y[:ligação[:rotação]])" % spec)
+        self.width, self.height, self.x, self.y = (int(g) for g in m.groups()[:4])
+        self.serpentine = m.group(5) != "progressive"
+        self.rotation = int(m.group(6) or 0)
+        self.first = first
+        self.w, self.h = rotated_size(self.width, self.height, self.rotation)
+
+    def count(self):
+        return self.width * self.height
+
+    def index(self, cx, cy):
+        # Índice na fita do ponto (cx, cy) da tela, ou None se fora do painel.
+        lx, ly = cx - self.x, cy - self.y
+        if not (0 <= lx < self.w and 0 <= ly < self.h):
+            return None
+        px, py = rotate(lx, ly, self.width, self.height, self.rotation)
+        if self.serpentine and py % 2:
+            px = self.width - 1 - px
+        return self.first + py * self.width + px
+
+
+def layout(specs, rotation, mirror):
+    panels = []
+    first = 0
+    for spec in specs:
+        panels.append(Panel(spec, first))
+        first += panels[-1].count()
+    count = first
+
+    cw = max(p.x + p.w for p in panels)
+    ch = max(p.y + p.h for p in panels)
+    lw, lh = rotated_size(cw, ch, rotation)
+
+    table = []
+    for y in range(lh):
+        row = []
+        for x in range(lw):
+            cx, cy = rotate(lw - 1 - x if mirror else x, y, cw, ch, rotation)
+            hits = [i for i in (p.index(cx, cy) for p in panels) if i is not None]
+            if len(hits) > 1:
+                raise SystemExit("painéis sobrepostos no ponto (%d, %d)" % (cx, cy))
+            row.append(hits[0] if hits else count)
+        table.append(row)
+    return lw, lh, count, table
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("panels", nargs="+", metavar="PAINEL")
+    ap.add_argument("--rotation", type=int, choices=(0, 90, 180, 270), default=0)
+    ap.add_argument("--mirror", action="store_true")
+    ap.add_argument("-o", "--output", default="neopixel_layout.h")
+    args = ap.parse_args()
+
+    lw, lh, count, table = layout(args.panels, args.rotation, args.mirror)
+    index_type = "uint8_t" if count <= 255 else "uint16_t"
+    width = len(str(count))
+
+    banner = "// Gerado por neopixel_layout.py (%s; rotação %d%s). Não edite à mão." % (
+        " ".join(args.panels), args.rotation, ", espelhado" if args.mirror else "")
+    out = [
+        banner,
+        "",
+        "#ifndef NEOPIXEL_LAYOUT_H",
+        "#define NEOPIXEL_LAYOUT_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Tela lógica, com (0, 0) no canto inferior esquerdo.",
+        "#define NP_WIDTH %d" % lw,
+        "#define NP_HEIGHT %d" % lh,
+        "",
+        "// LEDs na fita (soma dos painéis). Os buffers têm um pixel a mais, o dos pontos sem LED.",
+        "#define NP_LED_COUNT %d" % count,
+        "",
+        "typedef %s np_index_t;" % index_type,
+        "",
+        "// Índice na fita de cada ponto (x, y) da tela lógica.",
+        "extern const np_index_t np_xy[NP_HEIGHT][NP_WIDTH];",
+        "",
+        "#endif",
+    ]
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+    out = [
+        banner,
+        "",
+        '#include "%s"' % os.path.basename(args.output),
+        "",
+        "const np_index_t np_xy[NP_HEIGHT][NP_WIDTH] = {",
+    ]
+    for row in table:
+        out.append("    {" + ", ".join("%*d" % (width, i) for i in row) + "},")
+    out.append("};")
+    with open(os.path.splitext(args.output)[0] + ".c", "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#include <string.h>
+#include "neopixel_parallel.h"
+#include "neopixel_gamma.h"
+#include "ws2818b_parallel.pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Buffers de desenho, um por fita, no formato de "leds". Fitas não usadas ficam zeradas.
+npColor_t np_par_leds[NP_PAR_MAX_STRIPS][NP_PAR_LEDS_PER_STRIP + 1];
+
+// Dois buffers no formato da linha (planos de bits): um é lido pelo DMA enquanto o outro é montado.
+#define NP_PAR_WORDS (NP_PAR_LEDS_PER_STRIP * 6)
+static uint32_t np_par_wire[2][NP_PAR_WORDS];
+static uint np_par_next = 0;
+
+static PIO np_par_pio;
+static uint np_par_sm;
+static uint np_par_strips;
+static int np_par_dma_chan;
+static volatile bool np_par_busy = false;
+
+// Bit TXSTALL da máquina em FDEBUG: o RESET conta a partir do fim real dos dados, como em neopixel.c.
+static uint32_t np_par_txstall;
+
+static int64_t np_par_latch_callback(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+    np_par_busy = false;
+    return 0;
+}
+
+// Repete a cada NP_DRAIN_POLL_US até a FIFO esvaziar e a máquina parar; então agenda o RESET.
+static int64_t np_par_drain_callback(alarm_id_t id, void *user_data)
+{
+    (void)id;
+    (void)user_data;
+    if (!pio_sm_is_tx_fifo_empty(np_par_pio, np_par_sm) || !(np_par_pio->fdebug & np_par_txstall))
+        return NP_DRAIN_POLL_US;
+
+    if (add_alarm_in_us(NP_RESET_US, np_par_latch_callback, NULL, true) < 0)
+        np_par_latch_callback(0, NULL);
+    return 0;
+}
+
+static void np_par_dma_irq_handler(void)
+{
+    if (!dma_channel_get_irq0_status(np_par_dma_chan))
+        return;
+    dma_channel_acknowledge_irq0(np_par_dma_chan);
+
+    // A parada registrada é a do quadro anterior; a conferência começa pela estimativa da FIFO.
+    np_par_pio->fdebug = np_par_txstall;
+    uint drain_us = (pio_sm_get_tx_fifo_level(np_par_pio, np_par_sm) + 1) * NP_PAR_WORD_US;
+    if (add_alarm_in_us(drain_us, np_par_drain_callback, NULL, true) < 0)
+        np_par_latch_callback(0, NULL);
+}
+
+/**
+ * Inicializa a saída paralela: "strips" fitas a partir de pin_base (no máximo 8).
+ */
+void npParInit(uint pin_base, uint strips)
+{
+    if (strips > NP_PAR_MAX_STRIPS)
+        strips = NP_PAR_MAX_STRIPS;
+    np_par_strips = strips;
+
+    // Usa a pio0 se ela tiver espaço para o programa e uma máquina livre, senão a pio1.
+    np_par_pio = pio0;
+    int claimed = pio_can_add_program(pio0, &ws2818b_parallel_program) ? pio_claim_unused_sm(pio0, false) : -1;
+    if (claimed < 0)
+    {
+        np_par_pio = pio1;
+        claimed = pio_claim_unused_sm(np_par_pio, true);
+    }
+    np_par_sm = claimed;
+    np_par_txstall = 1u << (PIO_FDEBUG_TXSTALL_LSB + np_par_sm);
+    uint offset = pio_add_program(np_par_pio, &ws2818b_parallel_program);
+    ws2818b_parallel_program_init(np_par_pio, np_par_sm, offset, pin_base, strips, 800000.f);
+
+    np_par_dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(np_par_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(np_par_pio, np_par_sm, true));
+    dma_channel_configure(np_par_dma_chan, &c, &np_par_pio->txf[np_par_sm], np_par_wire[0], NP_PAR_WORDS, false);
+
+    dma_channel_set_irq0_enabled(np_par_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_0, np_par_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    npParClear();
+}
+
+/**
+ * Atribui uma cor RGB a um LED de uma das fitas.
+ */
+void npParSetLED(const uint strip, const uint index, const uint8_t r, const uint8_t g, const uint8_t b)
+{
+    if (strip >= np_par_strips)
+        return;
+    np_par_leds[strip][index] = NP_COLOR(r, g, b);
+}
+
+/**
+ * Limpa os buffers de todas as fitas.
+ */
+void npParClear()
+{
+    memset(np_par_leds, 0, sizeof(np_par_leds[0]) * np_par_strips);
+}
+
+/**
+ * Transposição 8x8 de bits (Hacker's Delight, 7-3) só com operações de 32 bits.
+ * x e y trazem um byte por fita (fita 7 no byte alto de x, fita 0 no byte baixo de y);
+ * out[k] recebe o bit 7-k de cada fita, com a fita s no bit s.
+ */
+static inline void np_transpose8(uint32_t x, uint32_t y, uint8_t *out)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[0] = x >> 24;
+    out[1] = x >> 16;
+    out[2] = x >> 8;
+    out[3] = x;
+    out[4] = y >> 24;
+    out[5] = y >> 16;
+    out[6] = y >> 8;
+    out[7] = y;
+}
+
+/**
+ * Converte o pixel "index" das 8 fitas nos 24 planos de bits da linha (G, R, B; MSB primeiro),
+ * passando cada canal pela tabela de gama e brilho atual.
+ */
+void npParTranspose(const npColor_t *const strips[NP_PAR_MAX_STRIPS], uint index, uint8_t planes[24])
+{
+    const uint16_t *lut = np_lut;
+    npColor_t p[NP_PAR_MAX_STRIPS];
+    for (uint s = 0; s < NP_PAR_MAX_STRIPS; ++s)
+        p[s] = strips[s][index];
+
+    // Canal no byte "sh" da palavra 0xGGRRBB00 de quatro fitas, um byte por fita.
+#define NP_PAR_PACK(sh, a, b, c, d) \
+    ((uint32_t)np_lut8(lut, p[a] >> (sh)) << 24 | (uint32_t)np_lut8(lut, p[b] >> (sh)) << 16 | \
+     (uint32_t)np_lut8(lut, p[c] >> (sh)) << 8 | np_lut8(lut, p[d] >> (sh)))
+
+    np_transpose8(NP_PAR_PACK(24, 7, 6, 5, 4), NP_PAR_PACK(24, 3, 2, 1, 0), planes);
+    np_transpose8(NP_PAR_PACK(16, 7, 6, 5, 4), NP_PAR_PACK(16, 3, 2, 1, 0), planes + 8);
+    np_transpose8(NP_PAR_PACK(8, 7, 6, 5, 4), NP_PAR_PACK(8, 3, 2, 1, 0), planes + 16);
+
+#undef NP_PAR_PACK
+}
+
+/**
+ * Escreve os buffers de todas as fitas nos LEDs, em paralelo.
+ *
+ * A transposição é feita no buffer de linha livre enquanto o quadro anterior
+ * ainda pode estar saindo; só então espera o RESET e dispara o DMA.
+ */
+void npParWrite()
+{
+    const npColor_t *strips[NP_PAR_MAX_STRIPS];
+    for (uint s = 0; s < NP_PAR_MAX_STRIPS; ++s)
+        strips[s] = np_par_leds[s];
+
+    uint32_t *wire = np_par_wire[np_par_next];
+    uint8_t *planes = (uint8_t *)wire; // Little-endian: o byte baixo de cada palavra sai primeiro.
+    for (uint i = 0; i < NP_PAR_LEDS_PER_STRIP; ++i, planes += 24)
+        npParTranspose(strips, i, planes);
+
+    npParWait();
+    np_par_busy = true;
+    dma_channel_transfer_from_buffer_now(np_par_dma_chan, wire, NP_PAR_WORDS);
+    np_par_next ^= 1;
+}
+
+/**
+ * Indica se há um quadro paralelo sendo transmitido (ou aguardando o RESET).
+ */
+bool npParBusy(void)
+{
+    return np_par_busy;
+}
+
+/**
+ * Aguarda o fim do quadro paralelo em andamento.
+ */
+void npParWait(void)
+{
+    while (np_par_busy)
+        tight_loop_contents();
+}
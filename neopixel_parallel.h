@@ -0,0 +1,31 @@
+#ifndef NEOPIXEL_PARALLEL_H
+#define NEOPIXEL_PARALLEL_H
+
+#include "neopixel.h"
+
+// Saída paralela: várias fitas (ou matrizes) em pinos consecutivos, uma máquina PIO.
+#define NP_PAR_MAX_STRIPS 8
+
+// LEDs por fita; todas as fitas são transmitidas com o mesmo comprimento.
+#ifndef NP_PAR_LEDS_PER_STRIP
+#define NP_PAR_LEDS_PER_STRIP LED_COUNT
+#endif
+
+// Tempo de linha de uma palavra da FIFO TX: 4 planos a 1,25us cada.
+#define NP_PAR_WORD_US 5
+
+// Buffers de desenho, um por fita, no formato de "leds" (0xGGRRBB00, ver NP_COLOR): valem
+// as operações de neopixel_swar.h. Como em "leds", o último pixel não é enviado.
+extern npColor_t np_par_leds[NP_PAR_MAX_STRIPS][NP_PAR_LEDS_PER_STRIP + 1];
+
+void npParInit(uint pin_base, uint strips);
+void npParSetLED(const uint strip, const uint index, const uint8_t r, const uint8_t g, const uint8_t b);
+void npParClear();
+void npParWrite();
+
+bool npParBusy(void);
+void npParWait(void);
+
+void npParTranspose(const npColor_t *const strips[NP_PAR_MAX_STRIPS], uint index, uint8_t planes[24]);
+
+#endif
@@ -0,0 +1,101 @@
+#include "neopixel_stream.h"
+
+// Posição de R, G e B (a ordem do protocolo) na palavra do pixel, 0xGGRRBB00.
+static const uint8_t np_stream_shift[3] = {16, 24, 8};
+
+/**
+ * Prepara o receptor para o primeiro cabeçalho.
+ */
+void npStreamInit(np_stream_t *s)
+{
+    s->header_len = 0;
+    s->text_len = 0;
+    s->pixels = false;
+    s->skip = false;
+    s->active = false;
+    s->last_us = 0;
+}
+
+// Devolve header[0..n) como texto (ou os descarta, durante a transmissão).
+static np_stream_event_t np_stream_text(np_stream_t *s, uint n)
+{
+    s->text_len = n;
+    return s->active || !n ? NP_STREAM_MORE : NP_STREAM_TEXT;
+}
+
+/**
+ * Recebe um byte do stdio e diz o que fazer com ele (ver np_stream_event_t).
+ *
+ * Entre NP_STREAM_START e NP_STREAM_FRAME o buffer de trás pertence ao receptor: quem
+ * chama não deve trocá-lo (npPresent) nem desenhar nele.
+ */
+np_stream_event_t npStreamPut(np_stream_t *s, uint8_t c, uint64_t now)
+{
+    // Host que parou (no meio do quadro ou entre quadros): o quadro é descartado e o que
+    // vier pode ser texto. Só o começo da assinatura, que pode ser texto digitado devagar,
+    // continua pendente.
+    if (now - s->last_us > NP_STREAM_TIMEOUT_US)
+    {
+        s->pixels = false;
+        s->skip = false;
+        s->active = false;
+        if (s->header_len >= sizeof(NP_STREAM_MAGIC) - 1)
+            s->header_len = 0;
+    }
+    s->last_us = now;
+
+    if (s->pixels)
+    {
+        uint i = s->pos / 3, k = s->pos % 3;
+        if (i < LED_COUNT && !s->skip)
+        {
+            // R é o primeiro byte do pixel e limpa os outros canais.
+            if (k == 0)
+                leds[i] = (npColor_t)c << np_stream_shift[0];
+            else
+                leds[i] |= (npColor_t)c << np_stream_shift[k];
+        }
+        if (++s->pos < s->count * 3)
+            return NP_STREAM_MORE;
+
+        s->pixels = false;
+        if (s->skip)
+            return NP_STREAM_MORE;
+        for (i = s->count; i < LED_COUNT; ++i)
+            leds[i] = 0;
+        return NP_STREAM_FRAME;
+    }
+
+    uint n = s->header_len;
+    if (n < sizeof(NP_STREAM_MAGIC) - 1)
+    {
+        if (c != (uint8_t)NP_STREAM_MAGIC[n])
+        {
+            // O byte que quebrou a assinatura pode começar outra ("AAda").
+            s->header_len = 0;
+            if (c == (uint8_t)NP_STREAM_MAGIC[0])
+            {
+                np_stream_event_t ev = np_stream_text(s, n);
+                s->header[s->header_len++] = c;
+                return ev;
+            }
+            s->header[n] = c;
+            return np_stream_text(s, n + 1);
+        }
+        s->header[s->header_len++] = c;
+        return NP_STREAM_MORE;
+    }
+
+    s->header[s->header_len++] = c;
+    if (s->header_len < NP_STREAM_HEADER_LEN)
+        return NP_STREAM_MORE;
+
+    // Soma errada: o quadro é descartado pelo tamanho declarado, sem virar texto.
+    s->count = (s->header[3] << 8 | s->header[4]) + 1;
+    s->pos = 0;
+    s->pixels = true;
+    s->active = true;
+    s->header_len = 0;
+    s->skip = (s->header[3] ^ s->header[4] ^ 0x55) != s->header[5];
+    return s->skip ? NP_STREAM_MORE : NP_STREAM_START;
+}
@@ -0,0 +1,53 @@
+#ifndef NEOPIXEL_STREAM_H
+#define NEOPIXEL_STREAM_H
+
+#include "neopixel.h"
+
+/*
+ * Quadros enviados pelo host no stdio (USB CDC), no protocolo Adalight:
+ *
+ *   'A' 'd' 'a' hi lo ck    cabeçalho: n - 1 = hi << 8 | lo pixels, ck = hi ^ lo ^ 0x55
+ *   R G B  (n vezes)        pixels na ordem da fita
+ *
+ * Cada byte de pixel vai direto para o seu canal no buffer de trás "leds", sem buffer
+ * intermediário; com o último, o quadro está pronto para npPresent(). LEDs além de n
+ * ficam apagados e pixels além de LED_COUNT são descartados.
+ *
+ * Um cabeçalho com soma errada ainda diz o tamanho do quadro: os n pixels seguintes são
+ * descartados, sem passar por texto nem por cabeçalho. Fora de quadros, os bytes voltam
+ * para quem chamou como texto, a menos que um quadro tenha chegado há menos de
+ * NP_STREAM_TIMEOUT_US: durante a transmissão, o que não é quadro é descartado.
+ */
+
+#define NP_STREAM_MAGIC "Ada"
+#define NP_STREAM_HEADER_LEN 6
+
+// Um quadro sem bytes novos por este tempo é abandonado, e o próximo byte volta a ser
+// cabeçalho (ou texto).
+#define NP_STREAM_TIMEOUT_US 100000
+
+typedef enum
+{
+    NP_STREAM_MORE,  // Byte consumido (ou descartado); o quadro continua.
+    NP_STREAM_START, // Cabeçalho válido: os próximos bytes escrevem no buffer de trás.
+    NP_STREAM_FRAME, // Último byte do quadro: o buffer de trás está pronto.
+    NP_STREAM_TEXT,  // Não é um quadro: header[0..text_len) são texto comum.
+} np_stream_event_t;
+
+typedef struct
+{
+    uint8_t header[NP_STREAM_HEADER_LEN];
+    uint8_t header_len; // Bytes do cabeçalho recebidos.
+    uint8_t text_len;   // Bytes devolvidos por NP_STREAM_TEXT.
+    bool pixels;        // Recebendo os pixels de um quadro.
+    bool skip;          // Pixels de um cabeçalho com soma errada: descartados.
+    bool active;        // Transmissão em andamento: bytes fora de quadros não são texto.
+    uint count;         // Pixels do quadro.
+    uint pos;           // Bytes de pixel já recebidos.
+    uint64_t last_us;   // Instante do último byte.
+} np_stream_t;
+
+void npStreamInit(np_stream_t *s);
+np_stream_event_t npStreamPut(np_stream_t *s, uint8_t c, uint64_t now);
+
+#endif
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include "neopixel_swar.h"
+
+// Quadros de teste do microbenchmark, na mesma forma de "leds".
+static npColor_t bench_a[LED_COUNT + 1], bench_b[LED_COUNT + 1];
+
+#define BENCH_FADE 200
+#define BENCH_ALPHA 96
+
+// Laços escalares de referência: os três canais de cada pixel, um byte por vez.
+static void fill_bytes(void)
+{
+    uint8_t *p = (uint8_t *)bench_a;
+    for (uint i = 0; i <= LED_COUNT; i++, p += 4)
+    {
+        p[1] = 64;
+        p[2] = 128;
+        p[3] = 255;
+    }
+}
+
+static void fade_bytes(void)
+{
+    uint8_t *p = (uint8_t *)bench_a;
+    for (uint i = 0; i <= LED_COUNT; i++, p += 4)
+        for (uint k = 1; k < 4; k++)
+            p[k] = p[k] * BENCH_FADE >> 8;
+}
+
+static void add_bytes(void)
+{
+    uint8_t *p = (uint8_t *)bench_a;
+    const uint8_t *q = (const uint8_t *)bench_b;
+    for (uint i = 0; i <= LED_COUNT; i++, p += 4, q += 4)
+        for (uint k = 1; k < 4; k++)
+        {
+            uint v = p[k] + q[k];
+            p[k] = v < 255 ? v : 255;
+        }
+}
+
+static void blend_bytes(void)
+{
+    uint8_t *p = (uint8_t *)bench_a;
+    const uint8_t *q = (const uint8_t *)bench_b;
+    for (uint i = 0; i <= LED_COUNT; i++, p += 4, q += 4)
+        for (uint k = 1; k < 4; k++)
+            p[k] = (q[k] * BENCH_ALPHA + p[k] * (256 - BENCH_ALPHA)) >> 8;
+}
+
+static void max_bytes(void)
+{
+    uint8_t *p = (uint8_t *)bench_a;
+    const uint8_t *q = (const uint8_t *)bench_b;
+    for (uint i = 0; i <= LED_COUNT; i++, p += 4, q += 4)
+        for (uint k = 1; k < 4; k++)
+            if (q[k] > p[k])
+                p[k] = q[k];
+}
+
+// Os mesmos laços de neopixel_draw.c (npFill, npFade...), sobre os quadros de teste.
+static void fill_swar(void)
+{
+    for (uint i = 0; i <= LED_COUNT; i++)
+        bench_a[i] = NP_COLOR(128, 255, 64);
+}
+
+static void fade_swar(void)
+{
+    for (uint i = 0; i <= LED_COUNT; i++)
+        bench_a[i] = np_scale(bench_a[i], BENCH_FADE);
+}
+
+static void add_swar(void)
+{
+    for (uint i = 0; i <= LED_COUNT; i++)
+        bench_a[i] = np_add(bench_a[i], bench_b[i]);
+}
+
+static void blend_swar(void)
+{
+    for (uint i = 0; i <= LED_COUNT; i++)
+        bench_a[i] = np_blend(bench_b[i], bench_a[i], BENCH_ALPHA);
+}
+
+static void max_swar(void)
+{
+    for (uint i = 0; i <= LED_COUNT; i++)
+        bench_a[i] = np_max(bench_a[i], bench_b[i]);
+}
+
+const np_swar_bench_t np_swar_bench[] = {
+    {"fill", fill_bytes, fill_swar},
+    {"fade", fade_bytes, fade_swar},
+    {"add", add_bytes, add_swar},
+    {"blend", blend_bytes, blend_swar},
+    {"max", max_bytes, max_swar},
+};
+
+const uint np_swar_bench_count = sizeof(np_swar_bench) / sizeof(np_swar_bench[0]);
+
+/**
+ * Preenche os quadros de teste com cores pseudoaleatórias.
+ */
+void npSwarBenchInit(void)
+{
+    uint32_t x = 0x2545f491u;
+    for (uint i = 0; i <= LED_COUNT; i++)
+    {
+        x = x * 1664525u + 1013904223u;
+        bench_a[i] = x & 0xffffff00u;
+        x = x * 1664525u + 1013904223u;
+        bench_b[i] = x & 0xffffff00u;
+    }
+}
+
+#if NP_PROF
+
+#define BENCH_RUNS 16
+
+// Ciclos de clk_sys por quadro, média de BENCH_RUNS execuções.
+static uint32_t bench_cycles(void (*fn)(void))
+{
+    npSwarBenchInit();
+    uint32_t t0 = prof_now();
+    for (uint r = 0; r < BENCH_RUNS; r++)
+        fn();
+    return ((t0 - prof_now()) & 0xffffffu) / BENCH_RUNS;
+}
+
+/**
+ * Imprime em CSV os ciclos por quadro de cada operação, escalar e SWAR.
+ */
+void npSwarBenchDump(void)
+{
+    printf("# swar led_count=%u\n", (unsigned)LED_COUNT);
+    printf("op,scalar,swar\n");
+    for (uint i = 0; i < np_swar_bench_count; i++)
+    {
+        uint32_t scalar = bench_cycles(np_swar_bench[i].scalar);
+        uint32_t swar = bench_cycles(np_swar_bench[i].swar);
+        printf("%s,%u,%u\n", np_swar_bench[i].name, (unsigned)scalar, (unsigned)swar);
+    }
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef NEOPIXEL_SWAR_H
+#define NEOPIXEL_SWAR_H
+
+#include "neopixel.h"
+#include "prof.h"
+
+/*
+ * Operações por pixel sobre a palavra empacotada (npColor_t, 0xGGRRBB00), sem separar os canais.
+ *
+ * O Cortex-M0+ não tem SIMD: cada palavra é dividida em duas metades com a máscara 0x00ff00ff,
+ * R e o byte vazio numa, G e B na outra, e cada canal ganha 16 bits de folga para o resultado de
+ * um produto ou de uma soma. Uma multiplicação trata dois canais por vez, sem vazar para o vizinho.
+ */
+
+#define NP_SWAR_LO 0x00ff00ffu
+
+/**
+ * Escala os três canais por f/256 (0..256; 256 mantém a cor).
+ */
+static inline npColor_t np_scale(npColor_t c, uint f)
+{
+    uint32_t rb = ((c & NP_SWAR_LO) * f >> 8) & NP_SWAR_LO;
+    uint32_t gb = ((c >> 8) & NP_SWAR_LO) * f & ~NP_SWAR_LO;
+    return rb | gb;
+}
+
+/**
+ * Soma canal a canal, saturando em 255.
+ */
+static inline npColor_t np_add(npColor_t a, npColor_t b)
+{
+    uint32_t lo = (a & NP_SWAR_LO) + (b & NP_SWAR_LO);
+    uint32_t hi = ((a >> 8) & NP_SWAR_LO) + ((b >> 8) & NP_SWAR_LO);
+
+    // O vai-um de cada canal (bit 8) vira 0xff no canal.
+    uint32_t c = lo & 0x01000100u;
+    lo = (lo | (c - (c >> 8))) & NP_SWAR_LO;
+    c = hi & 0x01000100u;
+    hi = (hi | (c - (c >> 8))) & NP_SWAR_LO;
+    return lo | hi << 8;
+}
+
+/**
+ * Mistura a com b: alpha/256 de a (0..256; 256 dá a).
+ */
+static inline npColor_t np_blend(npColor_t a, npColor_t b, uint alpha)
+{
+    uint beta = 256 - alpha;
+    uint32_t lo = ((a & NP_SWAR_LO) * alpha + (b & NP_SWAR_LO) * beta) >> 8;
+    uint32_t hi = ((a >> 8) & NP_SWAR_LO) * alpha + ((b >> 8) & NP_SWAR_LO) * beta;
+    return (lo & NP_SWAR_LO) | (hi & ~NP_SWAR_LO);
+}
+
+/**
+ * Máximo canal a canal.
+ */
+static inline npColor_t np_max(npColor_t a, npColor_t b)
+{
+    // Com o bit 8 ligado antes da subtração, ele só sobra nos canais em que a >= b.
+    uint32_t lo_a = a & NP_SWAR_LO, lo_b = b & NP_SWAR_LO;
+    uint32_t hi_a = (a >> 8) & NP_SWAR_LO, hi_b = (b >> 8) & NP_SWAR_LO;
+    uint32_t m = (((lo_a | 0x01000100u) - lo_b) >> 8) & 0x00010001u;
+    m = (m << 8) - m;
+    uint32_t lo = (lo_a & m) | (lo_b & ~m);
+    m = (((hi_a | 0x01000100u) - hi_b) >> 8) & 0x00010001u;
+    m = (m << 8) - m;
+    uint32_t hi = (hi_a & m) | (hi_b & ~m);
+    return lo | hi << 8;
+}
+
+// Microbenchmark: cada operação sobre um quadro de LED_COUNT pixels, no laço escalar (um
+// canal por vez, byte a byte) e com as funções acima. Os quadros de teste são internos.
+typedef struct
+{
+    const char *name;
+    void (*scalar)(void);
+    void (*swar)(void);
+} np_swar_bench_t;
+
+extern const np_swar_bench_t np_swar_bench[];
+extern const uint np_swar_bench_count;
+
+void npSwarBenchInit(void);
+
+#if NP_PROF
+void npSwarBenchDump(void);
+#else
+static inline void npSwarBenchDump(void) {}
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+#include "neopixel_text.h"
+#include "neopixel_draw.h"
+
+// Fonte 3x5 de ' ' a 'Z': coluna c nos bits 5c..5c+4, linha de cima no bit mais baixo.
+static const uint16_t np_font[] = {
+    0x0000, 0x02e0, 0x0c03, 0x7d5f, 0x27f2, 0x4889, 0x6aaa, 0x0060, // espaço ! " # $ % & '
+    0x45c0, 0x01d1, 0x288a, 0x11c4, 0x0110, 0x1084, 0x0200, 0x0c98, // ( ) * + , - . /
+    0x7e3f, 0x43f2, 0x5ebd, 0x7eb5, 0x7c87, 0x76b7, 0x76bf, 0x1f21, // 0 1 2 3 4 5 6 7
+    0x7ebf, 0x7eb7, 0x0140, 0x0150, 0x4544, 0x294a, 0x1151, 0x1ea1, // 8 9 : ; < = > ?
+    0x5ebf, 0x78be, 0x2abf, 0x462e, 0x3a3f, 0x46bf, 0x04bf, 0x762e, // @ A B C D E F G
+    0x7c9f, 0x47f1, 0x3e08, 0x6c9f, 0x421f, 0x7cdf, 0x783f, 0x3a2e, // H I J K L M N O
+    0x08bf, 0x5b2e, 0x68bf, 0x26b2, 0x07e1, 0x7e1f, 0x3e0f, 0x7d9f, // P Q R S T U V W
+    0x6c9b, 0x0f83, 0x4eb9, // X Y Z
+};
+
+uint8_t npFontColumn(char ch, uint col)
+{
+    if (ch >= 'a' && ch <= 'z')
+        ch -= 'a' - 'A';
+    if (ch < ' ' || ch > 'Z')
+        ch = '?';
+    return (np_font[ch - ' '] >> (col * NP_FONT_HEIGHT)) & ((1u << NP_FONT_HEIGHT) - 1);
+}
+
+/**
+ * Inicia o letreiro com o texto (terminado em zero), que deve existir até o fim da animação.
+ */
+void npMarqueeStart(np_player_t *p, const char *text, npColor_t color, uint repeat, uint64_t now)
+{
+    npPlayerStart(p, npMarqueeStep, color, NP_MARQUEE_FPS, repeat, now);
+    p->data = text;
+}
+
+/**
+ * Passo do letreiro: desloca a tela uma coluna para a esquerda e desenha a próxima
+ * coluna do texto na borda direita. Depois do último caractere, a tela ainda anda
+ * NP_WIDTH colunas para o texto sair por inteiro.
+ *
+ * p->delta é o caractere atual e p->frame a coluna dentro dele (a última é o espaço
+ * entre caracteres), ou as colunas já andadas depois do fim.
+ */
+uint32_t npMarqueeStep(np_player_t *p)
+{
+    const char *text = p->data;
+    char ch = text[p->delta];
+    uint8_t column = 0;
+
+    if (ch)
+    {
+        if (p->frame < NP_FONT_WIDTH)
+            column = npFontColumn(ch, p->frame);
+        if (++p->frame == NP_FONT_WIDTH + 1)
+        {
+            p->frame = 0;
+            p->delta++;
+        }
+    }
+    else if (p->frame++ == NP_WIDTH)
+        return NP_STEP_DONE;
+
+    npScroll(-1, 0, 0);
+    for (uint r = 0; r < NP_FONT_HEIGHT; r++)
+        if (column & (1u << r))
+            npSetPixel(NP_WIDTH - 1, NP_MARQUEE_Y + NP_FONT_HEIGHT - 1 - r, p->arg);
+    return 1;
+}
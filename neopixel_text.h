@@ -0,0 +1,31 @@
+#ifndef NEOPIXEL_TEXT_H
+#define NEOPIXEL_TEXT_H
+
+#include "neopixel_anim.h"
+
+/*
+ * Letreiro: texto que entra pela direita da tela, uma coluna por passo.
+ *
+ * A fonte 3x5 fica na flash, uma palavra por caractere com as colunas empacotadas.
+ * O texto não é copiado nem desenhado por inteiro: cada passo desloca a tela e lê só
+ * a próxima coluna do caractere atual, então a RAM usada não depende do tamanho do texto.
+ */
+
+#define NP_FONT_WIDTH 3
+#define NP_FONT_HEIGHT 5
+
+// Colunas por segundo (grade do governador de quadros).
+#define NP_MARQUEE_FPS 10
+
+// Linha de baixo do texto: centralizado na altura da tela.
+#define NP_MARQUEE_Y ((NP_HEIGHT - NP_FONT_HEIGHT) / 2)
+
+/**
+ * Coluna "col" do caractere: bit r aceso na linha r, de cima para baixo.
+ */
+uint8_t npFontColumn(char ch, uint col);
+
+void npMarqueeStart(np_player_t *p, const char *text, npColor_t color, uint repeat, uint64_t now);
+uint32_t npMarqueeStep(np_player_t *p);
+
+#endif
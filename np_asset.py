@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+"""Compila animações (JSON ou folhas de sprites PNG) no formato compacto lido por neopixel_asset.c.
+
+Cada fonte .json descreve uma animação:
+    {"fps": 10, "width": 5, "height": 5,
+     "palette": {".": [0, 0, 0], "o": [255, 128, 0]},
+     "frames": [{"hold_ms": 400, "rows": ["...oo", ".....", ...]}, ...]}
+com as linhas de cima para baixo, um caractere da paleta por ponto. Ou, no lugar de
+"palette" e "frames", uma folha de sprites:
+    {"fps": 10, "width": 5, "height": 5, "sheet": "fogo.png", "hold_ms": 100}
+com os quadros lado a lado, da esquerda para a direita e de cima para baixo (PNG de 8 bits,
+RGB, RGBA ou indexado, sem entrelaçamento; "hold_ms" pode ser uma lista, um por quadro).
+A paleta sai das cores usadas (no máximo 256).
+
+Blob (little-endian):
+    "NPA" 1                       assinatura e versão
+    largura altura fps cores      um byte cada (cores: 0 = 256)
+    quadros                       u16
+    paleta                        R G B por cor
+    por quadro: tipo espera tamanho(u16) dados
+        tipo 0 (chave)   pares (n - 1, cor): n pontos seguidos da cor
+        tipo 1 (delta)   trios (pula, n, cor): pula pontos iguais ao quadro anterior e
+                         pinta os n seguintes; os pontos depois do último trio não mudam
+Os pontos vão de baixo para cima e da esquerda para a direita, como a tela; a espera é em
+períodos de 1/fps. Cada quadro usa o menor dos dois tipos (o primeiro é sempre chave).
+
+Saída em DIR: np_assets.c e np_assets.h (um vetor const por animação, que fica na flash) e
+assets/NOME.npa (o mesmo blob, para o simulador carregar com mmap). Para cada animação,
+imprime o tamanho contra os quadros crus (3 bytes por ponto).
+
+Uso: python3 np_asset.py -o DIR FONTE...
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import zlib
+
+MAGIC = b"NPA\x01"
+KEY, DELTA = 0, 1
+
+
+def read_png(path):
+    # Decodifica um PNG de 8 bits por canal; retorna (largura, altura, linhas de tuplas RGB).
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise SystemExit("%s: não é PNG" % path)
+    pos, idat, plte = 8, b"", None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            plte = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+    channels = {2: 3, 6: 4, 3: 1}.get(ctype)
+    if depth != 8 or channels is None or interlace:
+        raise SystemExit("%s: só PNG de 8 bits, RGB, RGBA ou indexado, sem entrelaçamento" % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+        if ctype == 3:
+            rows.append([plte[v] for v in line])
+        else:
+            # Transparente (alfa 0) vira apagado.
+            rows.append([tuple(line[x:x + 3]) if channels == 3 or line[x + 3] else (0, 0, 0)
+                         for x in range(0, stride, channels)])
+    return width, height, rows
+
+
+def load(path):
+    # Retorna (fps, largura, altura, paleta RGB, quadros como listas de índices, esperas em ms).
+    with open(path, encoding="utf-8") as f:
+        src = json.load(f)
+    fps, width, height = src["fps"], src["width"], src["height"]
+
+    if "sheet" in src:
+        sw, sh, pixels = read_png(os.path.join(os.path.dirname(path), src["sheet"]))
+        images = []
+        for top in range(0, sh - height + 1, height):
+            for left in range(0, sw - width + 1, width):
+                images.append([pixels[top + height - 1 - y][left + x] for y in range(height) for x in range(width)])
+        palette = sorted(set(c for img in images for c in img))
+        if len(palette) > 256:
+            raise SystemExit("%s: %d cores (máximo 256)" % (path, len(palette)))
+        index = {c: i for i, c in enumerate(palette)}
+        frames = [[index[c] for c in img] for img in images]
+        holds = src["hold_ms"] if isinstance(src["hold_ms"], list) else [src["hold_ms"]] * len(frames)
+    else:
+        chars = list(src["palette"])
+        if len(chars) > 256:
+            raise SystemExit("%s: %d cores (máximo 256)" % (path, len(chars)))
+        palette = [tuple(src["palette"][ch]) for ch in chars]
+        index = {ch: i for i, ch in enumerate(chars)}
+        frames, holds = [], []
+        for n, fr in enumerate(src["frames"]):
+            rows = fr["rows"]
+            if len(rows) != height or any(len(r) != width for r in rows):
+                raise SystemExit("%s: quadro %d não tem %dx%d pontos" % (path, n + 1, width, height))
+            try:
+                frames.append([index[rows[height - 1 - y][x]] for y in range(height) for x in range(width)])
+            except KeyError as e:
+                raise SystemExit("%s: quadro %d usa %s, fora da paleta" % (path, n + 1, e))
+            holds.append(fr["hold_ms"])
+
+    if not frames or len(holds) != len(frames):
+        raise SystemExit("%s: quadros e esperas não batem" % path)
+    return fps, width, height, palette, frames, holds
+
+
+def encode_key(cur):
+    out, i = bytearray(), 0
+    while i < len(cur):
+        j = i
+        while j < len(cur) and j - i < 256 and cur[j] == cur[i]:
+            j += 1
+        out += bytes((j - i - 1, cur[i]))
+        i = j
+    return out
+
+
+def encode_delta(prev, cur):
+    out, i, n = bytearray(), 0, len(cur)
+    while i < n:
+        skip = 0
+        while i < n and cur[i] == prev[i] and skip < 255:
+            skip += 1
+            i += 1
+        if i == n:
+            break
+        if cur[i] == prev[i]:
+            out += bytes((skip, 0, 0))
+            continue
+        run, color = 0, cur[i]
+        while i < n and run < 255 and cur[i] == color:
+            run += 1
+            i += 1
+        out += bytes((skip, run, color))
+    return out
+
+
+def compile_asset(path):
+    fps, width, height, palette, frames, holds = load(path)
+    if not (1 <= width <= 255 and 1 <= height <= 255 and 1 <= fps <= 255):
+        raise SystemExit("%s: largura, altura e fps devem estar entre 1 e 255" % path)
+
+    blob = bytearray(MAGIC)
+    blob += struct.pack("<BBBBH", width, height, fps, len(palette) & 0xFF, len(frames))
+    for c in palette:
+        blob += bytes(c)
+
+    prev = None
+    for n, (cur, hold_ms) in enumerate(zip(frames, holds)):
+        # Espera arredondada para períodos da grade (a unidade de npAssetStep, ver neopixel_asset.h); pelo menos um.
+        hold = max(1, (hold_ms * fps + 500) // 1000)
+        if hold > 255:
+            raise SystemExit("%s: quadro %d espera mais de 255 períodos" % (path, n + 1))
+        kind, data = KEY, encode_key(cur)
+        if prev is not None:
+            delta = encode_delta(prev, cur)
+            if len(delta) < len(data):
+                kind, data = DELTA, delta
+        blob += struct.pack("<BBH", kind, hold, len(data)) + data
+        prev = cur
+
+    raw = len(frames) * width * height * 3
+    return blob, raw, len(frames), width, height
+
+
+def c_name(path):
+    return re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("sources", nargs="+", metavar="FONTE")
+    ap.add_argument("-o", "--output", default=".")
+    args = ap.parse_args()
+
+    os.makedirs(os.path.join(args.output, "assets"), exist_ok=True)
+    header = [
+        "// Gerado por np_asset.py. Não edite à mão.",
+        "",
+        "#ifndef NP_ASSETS_H",
+        "#define NP_ASSETS_H",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    source = ["// Gerado por np_asset.py. Não edite à mão.", "", '#include "np_assets.h"', ""]
+
+    for path in args.sources:
+        name = c_name(path)
+        blob, raw, count, width, height = compile_asset(path)
+        with open(os.path.join(args.output, "assets", name + ".npa"), "wb") as f:
+            f.write(blob)
+        print("np_asset: %s: %d quadros %dx%d, %d bytes crus -> %d bytes (%.1f%%, %.1f:1)"
+              % (name, count, width, height, raw, len(blob), 100.0 * len(blob) / raw, raw / len(blob)))
+
+        header.append("extern const uint8_t np_asset_%s[%d];" % (name, len(blob)))
+        source.append("const uint8_t np_asset_%s[%d] = {" % (name, len(blob)))
+        for i in range(0, len(blob), 16):
+            source.append("    " + ", ".join("0x%02x" % b for b in blob[i:i + 16]) + ",")
+        source += ["};", ""]
+
+    header += ["", "#endif"]
+    with open(os.path.join(args.output, "np_assets.h"), "w", encoding="utf-8") as f:
+        f.write("\n".join(header) + "\n")
+    with open(os.path.join(args.output, "np_assets.c"), "w", encoding="utf-8") as f:
+        f.write("\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
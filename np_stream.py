@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Envia quadros à matriz pelo terminal USB (ou pelo pseudoterminal do simulador, opção -p).
+
+Protocolo Adalight (ver neopixel_stream.h): "Ada", n - 1 em dois bytes (alto, baixo),
+a soma alto ^ baixo ^ 0x55 e n pixels R G B na ordem da fita. O padrão enviado é um arco-íris
+que anda um LED por quadro. Sem --fps, escreve o mais rápido que o dispositivo aceitar: o
+ritmo passa a ser o da placa, que só consome um quadro quando o anterior já foi trocado.
+
+No fim, imprime os quadros e bytes por segundo obtidos.
+
+Uso: python3 np_stream.py [--leds 25] [--fps 0] [--seconds 5] DISPOSITIVO
+"""
+
+import argparse
+import os
+import sys
+import termios
+import time
+import tty
+
+
+def header(count):
+    hi, lo = (count - 1) >> 8, (count - 1) & 0xFF
+    return bytes((ord("A"), ord("d"), ord("a"), hi, lo, hi ^ lo ^ 0x55))
+
+
+def wheel(pos):
+    # Roda de cores de 0 a 255: vermelho -> verde -> azul -> vermelho.
+    pos &= 0xFF
+    if pos < 85:
+        return (255 - pos * 3, pos * 3, 0)
+    if pos < 170:
+        pos -= 85
+        return (0, 255 - pos * 3, pos * 3)
+    pos -= 170
+    return (pos * 3, 0, 255 - pos * 3)
+
+
+def frame(count, n):
+    data = bytearray(header(count))
+    for i in range(count):
+        data += bytes(wheel((i + n) * 256 // count))
+    return bytes(data)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("device", metavar="DISPOSITIVO")
+    ap.add_argument("--leds", type=int, default=25)
+    ap.add_argument("--fps", type=float, default=0)
+    ap.add_argument("--seconds", type=float, default=5)
+    args = ap.parse_args()
+
+    if not 1 <= args.leds <= 65536:
+        ap.error("--leds deve estar entre 1 e 65536")
+
+    fd = os.open(args.device, os.O_WRONLY | os.O_NOCTTY)
+    if os.isatty(fd):
+        tty.setraw(fd)
+        termios.tcflush(fd, termios.TCOFLUSH)
+
+    frames = [frame(args.leds, n) for n in range(args.leds)]
+    period = 1 / args.fps if args.fps else 0
+    sent = 0
+    nbytes = 0
+    start = time.monotonic()
+    end = start + args.seconds
+    while time.monotonic() < end:
+        data = frames[sent % len(frames)]
+        view = memoryview(data)
+        while view:
+            view = view[os.write(fd, view):]
+        sent += 1
+        nbytes += len(data)
+        if period:
+            delay = start + sent * period - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+
+    elapsed = time.monotonic() - start
+    os.close(fd)
+    print(f"{sent} quadros em {elapsed:.2f} s: {sent / elapsed:.1f} quadros/s, {nbytes / elapsed / 1000:.1f} kB/s",
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+#include "prof.h"
+
+#if NP_PROF
+
+#include <stdio.h>
+#include "hardware/clocks.h"
+
+static const char *const prof_names[PROF_SITES] = {
+    "np_write",
+    "np_encode",
+    "keypad",
+    "render",
+    "loop_input",
+    "loop_render",
+};
+
+prof_hist_t prof_hist[PROF_SITES];
+
+/**
+ * Liga o SysTick do núcleo que chamou: clk_sys, recarga máxima, sem interrupção.
+ */
+void prof_init(void)
+{
+    systick_hw->csr = 0;
+    systick_hw->rvr = 0xffffffu;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // ENABLE | CLKSOURCE (clk_sys)
+}
+
+/**
+ * Acrescenta uma amostra ao histograma do ponto de medição.
+ */
+void prof_record(prof_site_t site, uint32_t cycles)
+{
+    prof_hist_t *h = &prof_hist[site];
+    uint b = cycles ? 32 - __builtin_clz(cycles) : 0;
+
+    if (!h->count || cycles < h->min)
+        h->min = cycles;
+    if (cycles > h->max)
+        h->max = cycles;
+    h->bucket[b < PROF_BUCKETS ? b : PROF_BUCKETS - 1]++;
+    h->count++;
+}
+
+// Limite superior da faixa que contém o percentil pct (limitado ao máximo observado).
+static uint32_t prof_percentile(const prof_hist_t *h, uint pct)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)h->count * pct + 99) / 100);
+    uint32_t seen = 0;
+    for (uint b = 0; b < PROF_BUCKETS; b++)
+    {
+        seen += h->bucket[b];
+        if (seen >= rank)
+        {
+            uint32_t upper = b ? (1u << b) - 1 : 0;
+            return upper < h->max ? upper : h->max;
+        }
+    }
+    return h->max;
+}
+
+/**
+ * Imprime os histogramas em CSV, em ciclos de clk_sys: resumo e contagem de cada faixa log2.
+ */
+void prof_dump(void)
+{
+    printf("# prof clk_sys=%u\n", (unsigned)clock_get_hz(clk_sys));
+    printf("site,count,min,p50,p99,max,buckets\n");
+    for (uint s = 0; s < PROF_SITES; s++)
+    {
+        const prof_hist_t *h = &prof_hist[s];
+        printf("%s,%u,%u,%u,%u,%u,", prof_names[s], (unsigned)h->count, (unsigned)h->min,
+               (unsigned)prof_percentile(h, 50), (unsigned)prof_percentile(h, 99), (unsigned)h->max);
+        for (uint b = 0; b < PROF_BUCKETS; b++)
+            printf(b ? " %u" : "%u", (unsigned)h->bucket[b]);
+        printf("\n");
+    }
+}
+
+/**
+ * Zera os histogramas.
+ */
+void prof_reset(void)
+{
+    for (uint s = 0; s < PROF_SITES; s++)
+        prof_hist[s] = (prof_hist_t){0};
+}
+
+#endif
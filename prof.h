@@ -0,0 +1,73 @@
+#ifndef PROF_H
+#define PROF_H
+
+#include "pico/stdlib.h"
+
+/*
+ * Instrumentação dos caminhos quentes: ciclos de clk_sys medidos pelo SysTick (24 bits,
+ * um por núcleo) e acumulados em histogramas log2 por ponto de medição, na RAM.
+ *
+ *     PROF_BEGIN(PROF_NP_WRITE);
+ *     ...
+ *     PROF_END(PROF_NP_WRITE);
+ *
+ * Com NP_PROF=0 (padrão) as macros não geram código algum.
+ */
+
+#ifndef NP_PROF
+#define NP_PROF 0
+#endif
+
+typedef enum
+{
+    PROF_NP_WRITE,    // npWrite(), incluindo a espera pelo quadro anterior.
+    PROF_NP_ENCODE,   // Codificação de um quadro para a linha (gama, brilho, pontilhamento).
+    PROF_KEYPAD,      // Interrupções do teclado (mapa da PIO e alarme de debounce).
+    PROF_RENDER,      // Passos de animação executados por npPlayerRun().
+    PROF_LOOP_INPUT,  // Iteração do laço de teclado/stdio, sem a espera.
+    PROF_LOOP_RENDER, // Iteração do laço de renderização (núcleo 1), sem a espera.
+    PROF_SITES
+} prof_site_t;
+
+// Faixa b conta amostras com 2^(b-1) <= ciclos < 2^b (faixa 0: zero ciclos).
+#define PROF_BUCKETS 25
+
+#if NP_PROF
+
+#include "hardware/structs/systick.h"
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min, max;
+    uint32_t bucket[PROF_BUCKETS];
+} prof_hist_t;
+
+extern prof_hist_t prof_hist[PROF_SITES];
+
+void prof_init(void);
+void prof_record(prof_site_t site, uint32_t cycles);
+void prof_dump(void);
+void prof_reset(void);
+
+// O SysTick conta para baixo e dá a volta a cada 2^24 ciclos (134 ms a 125 MHz).
+static inline uint32_t prof_now(void)
+{
+    return systick_hw->cvr;
+}
+
+#define PROF_BEGIN(site) uint32_t prof_t0_##site = prof_now()
+#define PROF_END(site) prof_record(site, (prof_t0_##site - prof_now()) & 0xffffffu)
+
+#else
+
+static inline void prof_init(void) {}
+static inline void prof_dump(void) {}
+static inline void prof_reset(void) {}
+
+#define PROF_BEGIN(site)
+#define PROF_END(site)
+
+#endif
+
+#endif
@@ -0,0 +1,375 @@
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "efeitos.h"
+#include "neopixel_asset.h"
+#include "neopixel_draw.h"
+#include "neopixel_swar.h"
+
+/*
+ * Benchmark dos efeitos do teclado (tabela de efeitos.c) sobre a HAL simulada.
+ *
+ * Cada efeito roda sozinho, do quadro apagado até o fim, no mesmo laço do firmware
+ * (npPlayerRun, com o governador de quadros, e espera ociosa). Por efeito:
+ *   frames            quadros travados nos LEDs
+ *   redundant_frames  quadros idênticos ao anterior
+ *   pio_words         escritas na FIFO TX da PIO
+ *   pio_bytes         bytes de dados nessas escritas
+ *   saved_bytes       bytes de cor não transmitidos (quadros sem mudança e fins de quadro
+ *                     sem mudança, ver npGetSavedBytes)
+ *   intended_ms       duração na grade do governador (soma dos períodos dos quadros)
+ *   elapsed_ms        tempo virtual até o fim da animação
+ *   intended_fps / achieved_fps   quadros por segundo sobre cada um dos tempos
+ *   cpu_blocked       fração do tempo em espera ativa (npWait, npSwap...)
+ *   missed            pontos da grade perdidos (quadro não pronto ou linha ocupada)
+ *   jitter_max_us     maior atraso de uma apresentação em relação ao seu prazo
+ *
+ * Depois, com pontilhamento temporal (npSetDither), um quadro parado por 1 s:
+ *   refresh_hz        reenvios travados por segundo
+ *   frame_us          intervalo médio entre eles
+ *   cpu_blocked       fração do tempo em espera ativa (a codificação roda na interrupção)
+ * O custo da codificação em ciclos só é medido na placa (NP_PROF=1, ponto np_encode).
+ *
+ * O travamento de um quadro inteiro e de um quadro em que só o primeiro pixel mudou:
+ *   full_us / one_pixel_us               de npWrite até o callback de npSetWriteCallback
+ *   full_reset_us / one_pixel_reset_us   do último bit na linha até o callback (o RESET
+ *                                        exige NP_RESET_US; o resto é espera perdida)
+ *
+ * Por fim, o desenho (neopixel_draw.c) contra o caminho de um pixel por vez com npSetLED,
+ * em ns de CPU do host por quadro (só a comparação entre eles tem sentido):
+ *   fill_setled_ns / fill_ns       tela inteira de uma cor
+ *   scroll_setled_ns / scroll_ns   tela deslocada um ponto para a esquerda
+ *
+ * E o fogo da tecla 5 (simulação e desenho de um quadro, sem o envio), com a tela do build
+ * (NP_PANELS): width, height e frame_ns; em "sizes", o mesmo em telas de 16x16 e 32x32.
+ *
+ * Por último, as operações de neopixel_swar.h sobre um quadro, contra o laço byte a byte
+ * (fill, fade, add, blend e max: scalar_ns e swar_ns). Na placa, a tecla 8 imprime o mesmo
+ * em ciclos (NP_PROF=1).
+ *
+ * Com -a, cada blob de np_asset.py (generated/assets/NOME.npa no build) é mapeado com
+ * mmap e medido como um efeito, com as mesmas chaves, em "assets".
+ *
+ * Uso: Animacoes_neopixel_bench [-o resultado.json] [-m grb8|grb24] [-a animacao.npa]...
+ */
+
+#define BENCH_LED_PIN 7
+#define BENCH_ASSETS_MAX 16
+
+static uint64_t frames = 0;
+static uint64_t redundant = 0;
+static uint8_t last_frame[LED_COUNT * 3];
+static size_t last_len = 0;
+static uint64_t last_frame_ns = 0;
+
+static void on_frame(unsigned int pin, const uint8_t *bytes, size_t len, uint64_t t_ns)
+{
+    (void)pin;
+    if (len > sizeof(last_frame))
+        len = sizeof(last_frame);
+    if (len == last_len && memcmp(bytes, last_frame, len) == 0)
+        redundant++;
+    memcpy(last_frame, bytes, len);
+    last_len = len;
+    last_frame_ns = t_ns;
+    frames++;
+}
+
+static void bench_efeito(FILE *out, const efeito_t *e)
+{
+    // Parte de um quadro apagado, já travado.
+    npClear();
+    npWrite();
+    npWait();
+    sim_pio_flush(true);
+
+    uint64_t frames0 = frames, redundant0 = redundant, words0, bytes0;
+    sim_pio_tx_counters(&words0, &bytes0);
+    uint64_t busy0 = sim_busy_ns(0);
+    uint32_t saved0 = npGetSavedBytes();
+    np_governor_stats_t gov;
+    npGovernorReset();
+    uint64_t t0 = time_us_64();
+
+    np_player_t p;
+    iniciar_efeito_de(&p, e, t0);
+    npPlayerFinish(&p);
+    uint64_t elapsed_us = time_us_64() - t0;
+    uint64_t intended_us = p.deadline - t0;
+    npGovernorStats(&gov);
+    double busy_us = (sim_busy_ns(0) - busy0) / 1e3;
+
+    // O último quadro ainda pode estar na linha.
+    npWait();
+    sim_pio_flush(true);
+
+    uint64_t words, bytes;
+    sim_pio_tx_counters(&words, &bytes);
+    uint64_t n = frames - frames0;
+
+    fprintf(out, "    {\"key\": \"%c\", \"name\": \"%s\", \"frames\": %llu, \"redundant_frames\": %llu, "
+                 "\"pio_words\": %llu, \"pio_bytes\": %llu, \"saved_bytes\": %u, \"intended_ms\": %.3f, \"elapsed_ms\": %.3f, "
+                 "\"intended_fps\": %.2f, \"achieved_fps\": %.2f, \"cpu_blocked\": %.4f, \"missed\": %u, \"jitter_max_us\": %u}",
+            e->key, e->name, (unsigned long long)n, (unsigned long long)(redundant - redundant0),
+            (unsigned long long)(words - words0), (unsigned long long)(bytes - bytes0),
+            (unsigned)(npGetSavedBytes() - saved0),
+            intended_us / 1e3, elapsed_us / 1e3,
+            intended_us ? n * 1e6 / intended_us : 0.0, elapsed_us ? n * 1e6 / elapsed_us : 0.0,
+            elapsed_us ? busy_us / elapsed_us : 0.0, (unsigned)gov.missed, (unsigned)gov.jitter_max_us);
+}
+
+static void bench_dither(FILE *out)
+{
+    for (uint i = 0; i < LED_COUNT; i++)
+        npSetLED(i, 255, 128, 64);
+    npWrite();
+    npWait();
+    sim_pio_flush(true);
+
+    uint64_t frames0 = frames, busy0 = sim_busy_ns(0);
+    uint64_t t0 = time_us_64();
+    npSetDither(true);
+    sleep_ms(1000);
+    npSetDither(false);
+    uint64_t elapsed_us = time_us_64() - t0;
+    double busy_us = (sim_busy_ns(0) - busy0) / 1e3;
+    uint64_t n = frames - frames0;
+
+    npWait();
+    sim_pio_flush(true);
+
+    fprintf(out, "  \"dither\": {\"refresh_hz\": %.2f, \"frame_us\": %.1f, \"cpu_blocked\": %.4f},\n",
+            n * 1e6 / elapsed_us, n ? (double)elapsed_us / n : 0.0, busy_us / elapsed_us);
+}
+
+static uint64_t latch_us;
+
+static void on_latch(void)
+{
+    latch_us = time_us_64();
+}
+
+// Apresenta o quadro de trás e espera o travamento: tempo até o callback e RESET após o último bit.
+static void bench_latch_frame(uint64_t *latch, uint64_t *reset)
+{
+    uint64_t t0 = time_us_64();
+    npWrite();
+    npWait();
+    sim_pio_flush(true);
+    *latch = latch_us - t0;
+    *reset = latch_us - last_frame_ns / 1000;
+}
+
+static void bench_latch(FILE *out)
+{
+    uint64_t full_us, full_reset_us, one_us, one_reset_us;
+    sleep_ms(1); // Termina o reenvio do pontilhamento que ainda estiver na linha.
+    npSetWriteCallback(on_latch);
+    npFill(NP_COLOR(255, 128, 64));
+    bench_latch_frame(&full_us, &full_reset_us);
+    leds[0] = 0;
+    bench_latch_frame(&one_us, &one_reset_us);
+    npSetWriteCallback(NULL);
+
+    fprintf(out, "  \"latch\": {\"full_us\": %llu, \"full_reset_us\": %llu, \"one_pixel_us\": %llu, \"one_pixel_reset_us\": %llu},\n",
+            (unsigned long long)full_us, (unsigned long long)full_reset_us, (unsigned long long)one_us,
+            (unsigned long long)one_reset_us);
+}
+
+#define BENCH_DRAW_ITERATIONS 200000
+
+static double host_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static void fill_setled(void)
+{
+    for (uint y = 0; y < NP_HEIGHT; y++)
+        for (uint x = 0; x < NP_WIDTH; x++)
+            npSetLED(npXY(x, y), 255, 128, 64);
+}
+
+static void scroll_setled(void)
+{
+    for (uint y = 0; y < NP_HEIGHT; y++)
+    {
+        for (uint x = 0; x + 1 < NP_WIDTH; x++)
+        {
+            npColor_t c = leds[npXY(x + 1, y)];
+            npSetLED(npXY(x, y), c >> 16, c >> 24, c >> 8);
+        }
+        npSetLED(npXY(NP_WIDTH - 1, y), 0, 0, 0);
+    }
+}
+
+static void fill_draw(void)
+{
+    npFill(NP_COLOR(255, 128, 64));
+}
+
+static void scroll_draw(void)
+{
+    npScroll(-1, 0, 0);
+}
+
+static double bench_draw_ns(void (*fn)(void))
+{
+    double t0 = host_ns();
+    for (uint i = 0; i < BENCH_DRAW_ITERATIONS; i++)
+        fn();
+    return (host_ns() - t0) / BENCH_DRAW_ITERATIONS;
+}
+
+static void bench_draw(FILE *out)
+{
+    fprintf(out, "  \"draw\": {\"fill_setled_ns\": %.1f, \"fill_ns\": %.1f, \"scroll_setled_ns\": %.1f, \"scroll_ns\": %.1f},\n",
+            bench_draw_ns(fill_setled), bench_draw_ns(fill_draw), bench_draw_ns(scroll_setled), bench_draw_ns(scroll_draw));
+}
+
+// Fogo sobre telas de outros tamanhos, sem a tabela de coordenadas: simulação e paleta
+// num buffer linear.
+#define BENCH_FIRE_MAX 32
+static const uint bench_fire_sizes[] = {16, BENCH_FIRE_MAX};
+static uint8_t bench_fire_heat[BENCH_FIRE_MAX * BENCH_FIRE_MAX];
+static npColor_t bench_fire_out[BENCH_FIRE_MAX * BENCH_FIRE_MAX];
+static uint bench_fire_size;
+
+static void fire_sized(void)
+{
+    uint n = bench_fire_size * bench_fire_size;
+    foguinho_simular(bench_fire_heat, bench_fire_size, bench_fire_size);
+    for (uint i = 0; i < n; i++)
+        bench_fire_out[i] = fogo_paleta[bench_fire_heat[i]];
+}
+
+static void bench_fire(FILE *out)
+{
+    foguinho_iniciar();
+    fprintf(out, "  \"fire\": {\"width\": %d, \"height\": %d, \"frame_ns\": %.1f, \"sizes\": [",
+            NP_WIDTH, NP_HEIGHT, bench_draw_ns(foguinho_quadro));
+    for (uint i = 0; i < sizeof(bench_fire_sizes) / sizeof(bench_fire_sizes[0]); i++)
+    {
+        bench_fire_size = bench_fire_sizes[i];
+        memset(bench_fire_heat, 0, sizeof(bench_fire_heat));
+        fprintf(out, "%s{\"width\": %u, \"height\": %u, \"frame_ns\": %.1f}", i ? ", " : "",
+                bench_fire_size, bench_fire_size, bench_draw_ns(fire_sized));
+    }
+    fprintf(out, "]},\n");
+}
+
+static void bench_swar(FILE *out)
+{
+    fprintf(out, "  \"swar\": {");
+    for (uint i = 0; i < np_swar_bench_count; i++)
+    {
+        npSwarBenchInit();
+        double scalar = bench_draw_ns(np_swar_bench[i].scalar);
+        npSwarBenchInit();
+        double swar = bench_draw_ns(np_swar_bench[i].swar);
+        fprintf(out, "%s\"%s\": {\"scalar_ns\": %.1f, \"swar_ns\": %.1f}", i ? ", " : "",
+                np_swar_bench[i].name, scalar, swar);
+    }
+    fprintf(out, "}\n");
+}
+
+// Mapeia um blob de np_asset.py; NULL (com a mensagem) se não abrir ou não for válido.
+static const uint8_t *bench_asset_map(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0)
+    {
+        perror(path);
+        if (fd >= 0)
+            close(fd);
+        return NULL;
+    }
+    void *m = st.st_size ? mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (m == MAP_FAILED || !npAssetCheck(m, st.st_size))
+    {
+        fprintf(stderr, "%s: não é uma animação de np_asset.py\n", path);
+        if (m != MAP_FAILED)
+            munmap(m, st.st_size);
+        return NULL;
+    }
+    return m;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_path = NULL;
+    np_mode_t mode = NP_MODE_GRB24;
+    efeito_t assets[BENCH_ASSETS_MAX];
+    uint assets_count = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out_path = argv[++i];
+        else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc && strcmp(argv[i + 1], "grb8") == 0)
+            mode = NP_MODE_GRB8, i++;
+        else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc && strcmp(argv[i + 1], "grb24") == 0)
+            mode = NP_MODE_GRB24, i++;
+        else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc && assets_count < BENCH_ASSETS_MAX)
+        {
+            const uint8_t *a = bench_asset_map(argv[++i]);
+            if (!a)
+                return 1;
+            assets[assets_count++] = (efeito_t){.key = '-', .name = argv[i], .asset = a, .repeat = 1};
+        }
+        else
+        {
+            fprintf(stderr, "uso: %s [-o resultado.json] [-m grb8|grb24] [-a animacao.npa]...\n", argv[0]);
+            return 2;
+        }
+    }
+
+    FILE *out = out_path ? fopen(out_path, "w") : stdout;
+    if (!out)
+    {
+        perror(out_path);
+        return 1;
+    }
+
+    sim_set_frame_hook(on_frame);
+    npInitMode(BENCH_LED_PIN, mode);
+
+    fprintf(out, "{\n  \"benchmark\": \"efeitos\",\n  \"mode\": \"%s\",\n  \"led_count\": %d,\n  \"effects\": [\n",
+            mode == NP_MODE_GRB24 ? "grb24" : "grb8", LED_COUNT);
+    for (uint i = 0; i < efeitos_count; i++)
+    {
+        bench_efeito(out, &efeitos[i]);
+        fprintf(out, i + 1 < efeitos_count ? ",\n" : "\n");
+    }
+    fprintf(out, "  ],\n");
+    if (assets_count)
+    {
+        fprintf(out, "  \"assets\": [\n");
+        for (uint i = 0; i < assets_count; i++)
+        {
+            bench_efeito(out, &assets[i]);
+            fprintf(out, i + 1 < assets_count ? ",\n" : "\n");
+        }
+        fprintf(out, "  ],\n");
+    }
+    bench_dither(out);
+    bench_latch(out);
+    bench_draw(out);
+    bench_fire(out);
+    bench_swar(out);
+    fprintf(out, "}\n");
+
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}
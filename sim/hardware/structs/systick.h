@@ -0,0 +1,19 @@
+#ifndef _HARDWARE_STRUCTS_SYSTICK_H
+#define _HARDWARE_STRUCTS_SYSTICK_H
+
+#include "pico/types.h"
+
+typedef struct
+{
+    io_rw_32 csr;
+    io_rw_32 rvr;
+    io_rw_32 cvr;
+    io_ro_32 calib;
+} systick_hw_t;
+
+// Na simulação, cvr é recalculado do relógio virtual (clk_sys, contagem decrescente de 24 bits)
+// a cada acesso a systick_hw.
+systick_hw_t *sim_systick_hw(void);
+#define systick_hw (sim_systick_hw())
+
+#endif
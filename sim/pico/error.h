@@ -0,0 +1,13 @@
+#ifndef _PICO_ERROR_H
+#define _PICO_ERROR_H
+
+// Códigos de erro do pico-sdk usados pelo projeto.
+enum pico_error_codes
+{
+    PICO_OK = 0,
+    PICO_ERROR_NONE = 0,
+    PICO_ERROR_TIMEOUT = -1,
+    PICO_ERROR_GENERIC = -2,
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef _PICO_STDLIB_H
+#define _PICO_STDLIB_H
+
+#include <stdio.h>
+#include "pico/types.h"
+#include "pico/error.h"
+#include "pico/time.h"
+#include "hardware/gpio.h"
+
+bool stdio_init_all(void);
+
+// Próximo caractere recebido (ver sim_stdin_push) ou PICO_ERROR_TIMEOUT após timeout_us.
+int getchar_timeout_us(uint32_t timeout_us);
+
+// printf do firmware passa pela HAL para poder custar tempo (ver sim_set_stdio_stall_us).
+int sim_printf(const char *format, ...);
+#define printf sim_printf
+
+// No host, espera ociosa avança o relógio virtual até o próximo evento.
+void tight_loop_contents(void);
+
+#endif
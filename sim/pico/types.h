@@ -0,0 +1,19 @@
+#ifndef _PICO_TYPES_H
+#define _PICO_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+typedef volatile uint32_t io_rw_32;
+typedef volatile uint32_t io_wo_32;
+typedef const volatile uint32_t io_ro_32;
+
+#define __not_in_flash_func(func) func
+#define __time_critical_func(func) func
+#define __not_in_flash(group)
+
+#endif
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Gera <programa>.pio.h para a HAL simulada, no lugar do pioasm.
+
+Não monta instruções (a simulação não as executa): emite, para cada
+.program, a struct pio_program com o tamanho certo, os defines de wrap e
+.define PUBLIC, e uma get_default_config que registra o nome do programa.
+Os blocos "% c-sdk { ... %}" são copiados sem alteração, como faz o pioasm.
+
+Uso: pio_header.py entrada.pio saida.pio.h
+"""
+import os
+import re
+import sys
+
+
+def parse(text):
+    programs = []
+    c_sdk = []
+    cur = None
+    in_c_sdk = False
+    for raw in text.splitlines():
+        if in_c_sdk:
+            if raw.strip() == "%}":
+                in_c_sdk = False
+            else:
+                c_sdk.append(raw)
+            continue
+        if raw.strip().startswith("% c-sdk"):
+            in_c_sdk = True
+            continue
+        line = re.split(r";|//", raw, maxsplit=1)[0].strip()
+        if not line:
+            continue
+        m = re.match(r"\.program\s+(\w+)", line)
+        if m:
+            cur = {"name": m.group(1), "length": 0, "wrap_target": 0, "wrap": None,
+                   "side_set": None, "defines": []}
+            programs.append(cur)
+            continue
+        if cur is None:
+            continue
+        if line.startswith(".wrap_target"):
+            cur["wrap_target"] = cur["length"]
+        elif line.startswith(".wrap"):
+            cur["wrap"] = cur["length"] - 1
+        elif line.startswith(".side_set"):
+            parts = line.split()
+            cur["side_set"] = (int(parts[1]), "opt" in parts[2:], "pindirs" in parts[2:])
+        elif line.startswith(".define"):
+            parts = line.split()
+            if len(parts) >= 4 and parts[1] == "PUBLIC":
+                cur["defines"].append((parts[2], parts[3]))
+        elif line.startswith("."):
+            continue
+        else:
+            # Rótulos ("nome:" ou "public nome:") podem preceder a instrução.
+            line = re.sub(r"^(public\s+)?\w+:\s*", "", line)
+            if line:
+                cur["length"] += 1
+    return programs, c_sdk
+
+
+def emit(programs, c_sdk, source):
+    out = ["// Gerado por sim/pio_header.py a partir de %s; não editar." % source,
+           "#pragma once", "", '#include "hardware/pio.h"', ""]
+    for p in programs:
+        n = p["name"]
+        wrap = p["wrap"] if p["wrap"] is not None else p["length"] - 1
+        out.append("#define %s_wrap_target %d" % (n, p["wrap_target"]))
+        out.append("#define %s_wrap %d" % (n, wrap))
+        for key, value in p["defines"]:
+            out.append("#define %s_%s %s" % (n, key, value))
+        out.append("")
+        out.append("static const struct pio_program %s_program = {" % n)
+        out.append("    .instructions = NULL,")
+        out.append("    .length = %d," % p["length"])
+        out.append("    .origin = -1,")
+        out.append("};")
+        out.append("")
+        out.append("static inline pio_sm_config %s_program_get_default_config(uint offset) {" % n)
+        out.append("    pio_sm_config c = pio_get_default_sm_config();")
+        out.append('    c.program = "%s";' % n)
+        out.append("    c.offset = offset;")
+        out.append("    sm_config_set_wrap(&c, offset + %s_wrap_target, offset + %s_wrap);" % (n, n))
+        if p["side_set"]:
+            count, opt, pindirs = p["side_set"]
+            out.append("    sm_config_set_sideset(&c, %d, %s, %s);"
+                       % (count + (1 if opt else 0), "true" if opt else "false",
+                          "true" if pindirs else "false"))
+        out.append("    return c;")
+        out.append("}")
+        out.append("")
+    out.extend(c_sdk)
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    src, dst = sys.argv[1], sys.argv[2]
+    with open(src) as f:
+        programs, c_sdk = parse(f.read())
+    os.makedirs(os.path.dirname(os.path.abspath(dst)), exist_ok=True)
+    with open(dst, "w") as f:
+        f.write(emit(programs, c_sdk, src.replace("\\", "/").split("/")[-1]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,66 @@
+#ifndef SIM_H
+#define SIM_H
+
+/*
+ * HAL simulada para compilar o firmware no host (Linux).
+ *
+ * Os cabeçalhos em sim/pico e sim/hardware imitam a parte do pico-sdk usada
+ * pelo projeto. O tempo é um relógio virtual em nanossegundos que só avança
+ * em sleep/busy_wait/tight_loop_contents, disparando na ordem certa alarmes,
+ * fins de DMA e interrupções. As máquinas PIO dos LEDs decodificam os bits
+ * como o WS2812 os recebe e entregam cada quadro travado a um gancho.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*sim_event_fn)(void *arg);
+
+// Relógio virtual.
+uint64_t sim_time_ns(void);
+void sim_advance_to(uint64_t t_ns);
+bool sim_next_event(uint64_t *t_ns);
+
+// Agenda fn(arg) para o instante t_ns; retorna um id > 0 (ou 0 se não houver espaço).
+int sim_schedule(uint64_t t_ns, sim_event_fn fn, void *arg);
+bool sim_cancel(int id);
+
+// Espera ativa até t_ns, contabilizada no núcleo atual; total por núcleo desde o boot.
+void sim_busy_wait_until(uint64_t t_ns);
+uint64_t sim_busy_ns(unsigned int core);
+
+// Interrupções (usadas pelo DMA e pela PIO simulados).
+void sim_irq_raise(unsigned int num);
+
+// Fecha/abre uma chave entre dois pinos: a entrada lê o nível da saída ligada a ela.
+void sim_gpio_connect(unsigned int a, unsigned int b, bool closed);
+bool sim_gpio_contact(unsigned int a, unsigned int b);
+
+// Cada printf do firmware bloqueia o núcleo por este tempo (padrão 0).
+void sim_set_stdio_stall_us(uint32_t us);
+
+// Texto digitado no terminal: chega ao firmware por getchar_timeout_us().
+void sim_stdin_push(const char *s);
+
+// Bytes quaisquer (ex.: quadros do host); retorna quantos couberam na fila de entrada.
+size_t sim_stdin_write(const void *buf, size_t len);
+size_t sim_stdin_free(void);
+
+// Quadro travado nos LEDs: bytes na ordem da linha, como o WS2812 os recebe. Um quadro
+// mais curto que os anteriores só troca o começo da fita; o hook recebe a fita inteira.
+typedef void (*sim_frame_hook_t)(unsigned int pin, const uint8_t *bytes, size_t len, uint64_t t_ns);
+void sim_set_frame_hook(sim_frame_hook_t hook);
+
+// Trava quadros pendentes cujo RESET já passou (ou todos, se force).
+void sim_pio_flush(bool force);
+
+// Chamado pela PIO quando uma palavra entra na FIFO TX; usado pelo DMA.
+struct pio_hw;
+uint64_t sim_pio_tx_push(struct pio_hw *pio, unsigned int sm, uint32_t word, uint64_t earliest_ns);
+bool sim_pio_tx_target(volatile void *addr, struct pio_hw **pio, unsigned int *sm);
+
+// Palavras escritas nas FIFOs TX e bytes de dados que carregavam (limiar de autopull), desde o boot.
+void sim_pio_tx_counters(uint64_t *words, uint64_t *bytes);
+
+#endif
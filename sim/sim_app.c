@@ -0,0 +1,250 @@
+// posix_openpt, ptsname e cfmakeraw (pseudoterminal da opção -p).
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+
+/*
+ * Executável do firmware no host: roda o main() de Animacoes_neopixel.c (renomeado
+ * para np_app_main) sobre a HAL simulada, aperta teclas conforme um roteiro e grava
+ * cada quadro travado nos LEDs, com seu instante, num arquivo de trace.
+ *
+ * Uso: Animacoes_neopixel_sim [-o trace] [-d duração_ms] [-s stall_us] [-p] [-t ms:texto]... [tecla@ms[:segura_ms]]...
+ *
+ *   -o trace      arquivo de saída (padrão: Animacoes_neopixel.trace); "-" é stdout,
+ *                 junto com os printf do firmware
+ *   -d ms         tempo virtual da simulação (padrão: 10000)
+ *   -s us         tempo que cada printf bloqueia o núcleo (stdio USB lento)
+ *   -t ms:texto   digita a linha "texto" no stdio em ms (o letreiro passa a mostrá-la)
+ *   -p            abre um pseudoterminal no lugar do USB CDC e imprime seu nome: o que o
+ *                 host escrever nele chega ao stdio do firmware (ex.: quadros de np_stream.py),
+ *                 e o relógio virtual passa a andar no ritmo do real
+ *   5@100:2000    aperta '5' em 100 ms e solta em 2100 ms (padrão: segura 100 ms)
+ *
+ * Cada linha do trace: "<us desde o boot> <pino> <bytes GRB em hexadecimal>".
+ */
+
+int np_app_main(void);
+
+// Definidos em keypad.c por pico_keypad_init().
+extern uint _columns[4];
+extern uint _rows[4];
+extern char _matrix_values[16];
+
+#define SIM_APP_MAX_ACTIONS 256
+
+typedef struct
+{
+    uint64_t at_us;
+    char key;
+    bool down;
+    const char *text; // Linha digitada no stdio, em vez de tecla.
+} sim_action_t;
+
+static sim_action_t actions[SIM_APP_MAX_ACTIONS];
+static uint action_count = 0;
+static uint next_action = 0;
+
+// Pseudoterminal (-p): lido a cada SIM_APP_PTY_POLL_US, só o que cabe na entrada do stdio,
+// então um host mais rápido que o firmware fica bloqueado na escrita, como no USB.
+#define SIM_APP_PTY_POLL_US 250
+
+static int pty_fd = -1;
+
+static FILE *trace;
+static uint64_t frame_count = 0;
+static struct timespec wall_start;
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "uso: %s [-o trace] [-d duração_ms] [-s stall_us] [-p] [-t ms:texto]... [tecla@ms[:segura_ms]]...\n", argv0);
+    exit(2);
+}
+
+static int action_cmp(const void *a, const void *b)
+{
+    const sim_action_t *x = a, *y = b;
+    return x->at_us < y->at_us ? -1 : x->at_us > y->at_us;
+}
+
+static void add_action(uint64_t at_us, char key, bool down, const char *text)
+{
+    if (action_count == SIM_APP_MAX_ACTIONS)
+    {
+        fprintf(stderr, "sim: roteiro com mais de %d ações\n", SIM_APP_MAX_ACTIONS);
+        exit(2);
+    }
+    actions[action_count++] = (sim_action_t){at_us, key, down, text};
+}
+
+// Fecha (ou abre) o contato da tecla na matriz: linha e coluna vêm do keypad já iniciado.
+static void press_key(char key, bool down)
+{
+    for (uint i = 0; i < 16; i++)
+    {
+        if (_matrix_values[i] == key)
+        {
+            sim_gpio_connect(_rows[i / 4], _columns[i % 4], down);
+            return;
+        }
+    }
+    fprintf(stderr, "sim: tecla '%c' fora do teclado\n", key);
+}
+
+// As ações entram na fila de eventos uma de cada vez, para não esgotá-la.
+static void run_action(void *arg)
+{
+    (void)arg;
+    const sim_action_t *a = &actions[next_action];
+    if (a->text)
+    {
+        sim_stdin_push(a->text);
+        sim_stdin_push("\n");
+    }
+    else
+        press_key(a->key, a->down);
+    if (++next_action < action_count)
+        sim_schedule(actions[next_action].at_us * 1000, run_action, NULL);
+}
+
+static void pty_poll(void *arg)
+{
+    (void)arg;
+    uint8_t buf[256];
+    size_t room = sim_stdin_free();
+    if (room > sizeof(buf))
+        room = sizeof(buf);
+    ssize_t n = room ? read(pty_fd, buf, room) : 0;
+    if (n > 0)
+        sim_stdin_write(buf, n);
+
+    // O relógio virtual espera o real, para o host escrever no seu próprio ritmo.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t ahead_ns = (int64_t)sim_time_ns() -
+                       ((now.tv_sec - wall_start.tv_sec) * 1000000000ll + (now.tv_nsec - wall_start.tv_nsec));
+    if (ahead_ns > 0)
+        nanosleep(&(struct timespec){ahead_ns / 1000000000, ahead_ns % 1000000000}, NULL);
+
+    sim_schedule(sim_time_ns() + SIM_APP_PTY_POLL_US * 1000, pty_poll, NULL);
+}
+
+// Abre o pseudoterminal em modo bruto (bytes binários, sem eco nem tradução de fim de linha).
+static void pty_open(void)
+{
+    pty_fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (pty_fd < 0 || grantpt(pty_fd) < 0 || unlockpt(pty_fd) < 0)
+    {
+        perror("sim: pty");
+        exit(1);
+    }
+    const char *name = ptsname(pty_fd);
+
+    // O lado do host fica aberto também aqui: sem isso, cada vez que o host fecha o
+    // terminal a leitura daria erro.
+    int slave = open(name, O_RDWR | O_NOCTTY);
+    struct termios t;
+    if (slave < 0 || tcgetattr(slave, &t) < 0)
+    {
+        perror(name);
+        exit(1);
+    }
+    cfmakeraw(&t);
+    tcsetattr(slave, TCSANOW, &t);
+    fcntl(pty_fd, F_SETFL, O_NONBLOCK);
+
+    fprintf(stderr, "sim: pty %s\n", name);
+}
+
+static void on_frame(unsigned int pin, const uint8_t *bytes, size_t len, uint64_t t_ns)
+{
+    fprintf(trace, "%llu %u ", (unsigned long long)(t_ns / 1000), pin);
+    for (size_t i = 0; i < len; i++)
+        fprintf(trace, "%02x", bytes[i]);
+    fputc('\n', trace);
+    frame_count++;
+}
+
+static void finish(void *arg)
+{
+    (void)arg;
+    sim_pio_flush(true);
+    fflush(stdout);
+
+    struct timespec wall_end;
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    double wall_ms = (wall_end.tv_sec - wall_start.tv_sec) * 1e3 + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e6;
+    fprintf(stderr, "sim: %llu quadros em %llu ms virtuais, %.1f ms de relógio real\n",
+            (unsigned long long)frame_count, (unsigned long long)(sim_time_ns() / 1000000), wall_ms);
+
+    if (trace != stdout)
+        fclose(trace);
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *trace_path = "Animacoes_neopixel.trace";
+    uint64_t duration_ms = 10000;
+    bool pty = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            trace_path = argv[++i];
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            duration_ms = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            sim_set_stdio_stall_us(strtoul(argv[++i], NULL, 10));
+        else if (strcmp(argv[i], "-p") == 0)
+            pty = true;
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            char *end;
+            uint64_t at_ms = strtoull(argv[++i], &end, 10);
+            if (*end != ':')
+                usage(argv[0]);
+            add_action(at_ms * 1000, 0, false, end + 1);
+        }
+        else if (argv[i][0] && argv[i][1] == '@')
+        {
+            char *end;
+            uint64_t at_ms = strtoull(argv[i] + 2, &end, 10);
+            uint64_t hold_ms = *end == ':' ? strtoull(end + 1, &end, 10) : 100;
+            if (*end)
+                usage(argv[0]);
+            add_action(at_ms * 1000, argv[i][0], true, NULL);
+            add_action((at_ms + hold_ms) * 1000, argv[i][0], false, NULL);
+        }
+        else
+            usage(argv[0]);
+    }
+
+    trace = strcmp(trace_path, "-") == 0 ? stdout : fopen(trace_path, "w");
+    if (!trace)
+    {
+        perror(trace_path);
+        return 1;
+    }
+
+    qsort(actions, action_count, sizeof(actions[0]), action_cmp);
+    if (action_count)
+        sim_schedule(actions[0].at_us * 1000, run_action, NULL);
+    sim_schedule(duration_ms * 1000000, finish, NULL);
+    sim_set_frame_hook(on_frame);
+    if (pty)
+    {
+        pty_open();
+        sim_schedule(0, pty_poll, NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+    return np_app_main();
+}
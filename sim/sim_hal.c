@@ -0,0 +1,782 @@
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "hardware/irq.h"
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+
+// Relógio virtual, em nanossegundos desde o "boot".
+static uint64_t now_ns = 0;
+
+// Fila de eventos agendados (alarmes, fim de DMA...).
+#define SIM_MAX_EVENTS 64
+
+typedef struct
+{
+    bool used;
+    int id;
+    uint64_t at_ns;
+    uint64_t seq; // Desempate: mesmo instante, ordem de agendamento.
+    sim_event_fn fn;
+    void *arg;
+} sim_event_t;
+
+static sim_event_t events[SIM_MAX_EVENTS];
+static int next_event_id = 1;
+static uint64_t next_seq = 0;
+
+uint64_t sim_time_ns(void)
+{
+    return now_ns;
+}
+
+int sim_schedule(uint64_t t_ns, sim_event_fn fn, void *arg)
+{
+    for (int i = 0; i < SIM_MAX_EVENTS; i++)
+    {
+        if (!events[i].used)
+        {
+            events[i] = (sim_event_t){true, next_event_id++, t_ns, next_seq++, fn, arg};
+            return events[i].id;
+        }
+    }
+    return 0;
+}
+
+bool sim_cancel(int id)
+{
+    for (int i = 0; i < SIM_MAX_EVENTS; i++)
+    {
+        if (events[i].used && events[i].id == id)
+        {
+            events[i].used = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+static sim_event_t *earliest_event(void)
+{
+    sim_event_t *best = NULL;
+    for (int i = 0; i < SIM_MAX_EVENTS; i++)
+    {
+        sim_event_t *e = &events[i];
+        if (e->used && (!best || e->at_ns < best->at_ns || (e->at_ns == best->at_ns && e->seq < best->seq)))
+            best = e;
+    }
+    return best;
+}
+
+bool sim_next_event(uint64_t *t_ns)
+{
+    sim_event_t *e = earliest_event();
+    if (e)
+        *t_ns = e->at_ns;
+    return e != NULL;
+}
+
+// Processa os eventos até t_ns e avança o relógio (um núcleo só).
+static void run_until(uint64_t t_ns)
+{
+    sim_event_t *e;
+    while ((e = earliest_event()) && e->at_ns <= t_ns)
+    {
+        sim_event_fn fn = e->fn;
+        void *arg = e->arg;
+        if (e->at_ns > now_ns)
+            now_ns = e->at_ns;
+        e->used = false;
+        fn(arg);
+    }
+    if (t_ns > now_ns)
+        now_ns = t_ns;
+    sim_pio_flush(false);
+}
+
+// ---------------------------------------------------------------------------
+// Dois núcleos: corrotinas sobre o mesmo relógio virtual.
+//
+// Código não consome tempo; cada núcleo roda até esperar (sleep, busy_wait, WFE...)
+// e então o núcleo com o menor prazo continua. Interrupções rodam no núcleo que
+// estiver executando quando o evento vence.
+
+#define SIM_CORE1_STACK (256 * 1024)
+
+static ucontext_t core_ctx[2];
+static uint sim_core = 0;
+static bool core1_launched = false;
+static uint64_t core_wake_ns[2];
+static bool core_in_wfe[2];
+
+void sim_advance_to(uint64_t t_ns)
+{
+    if (!core1_launched)
+    {
+        run_until(t_ns);
+        return;
+    }
+
+    uint self = sim_core;
+    core_wake_ns[self] = t_ns;
+    for (;;)
+    {
+        // Empate: o outro núcleo primeiro, para nenhum monopolizar o instante.
+        uint next = core_wake_ns[!self] <= core_wake_ns[self] ? !self : self;
+        uint64_t ev;
+        if (sim_next_event(&ev) && ev <= core_wake_ns[next])
+        {
+            run_until(ev);
+            continue;
+        }
+        run_until(core_wake_ns[next]);
+        if (next != self)
+        {
+            sim_core = next;
+            swapcontext(&core_ctx[self], &core_ctx[next]);
+            sim_core = self;
+        }
+        return;
+    }
+}
+
+static void (*core1_entry)(void);
+
+static void core1_trampoline(void)
+{
+    core1_entry();
+    // Núcleo 1 parado para sempre.
+    for (;;)
+        sim_advance_to(UINT64_MAX);
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+    core1_entry = entry;
+    getcontext(&core_ctx[1]);
+    core_ctx[1].uc_stack.ss_sp = malloc(SIM_CORE1_STACK);
+    core_ctx[1].uc_stack.ss_size = SIM_CORE1_STACK;
+    core_ctx[1].uc_link = NULL;
+    makecontext(&core_ctx[1], core1_trampoline, 0);
+    core_wake_ns[1] = now_ns;
+    core1_launched = true;
+}
+
+uint get_core_num(void)
+{
+    return sim_core;
+}
+
+// SEV: acorda o outro núcleo se ele estiver em WFE.
+static void sim_sev(void)
+{
+    uint other = !sim_core;
+    if (core_in_wfe[other] && core_wake_ns[other] > now_ns)
+        core_wake_ns[other] = now_ns;
+}
+
+// FIFOs entre núcleos (8 palavras em cada sentido); fifo[n] é lida pelo núcleo n.
+static struct
+{
+    uint32_t data[8];
+    uint head, count;
+} core_fifo[2];
+
+bool multicore_fifo_rvalid(void)
+{
+    return core_fifo[sim_core].count != 0;
+}
+
+bool multicore_fifo_wready(void)
+{
+    return core_fifo[!sim_core].count < 8;
+}
+
+void multicore_fifo_push_blocking(uint32_t data)
+{
+    while (!multicore_fifo_wready())
+        tight_loop_contents();
+    uint other = !sim_core;
+    core_fifo[other].data[(core_fifo[other].head + core_fifo[other].count++) % 8] = data;
+    sim_sev();
+}
+
+uint32_t multicore_fifo_pop_blocking(void)
+{
+    while (!multicore_fifo_rvalid())
+        best_effort_wfe_or_timeout(time_us_64() + 1000000);
+    uint self = sim_core;
+    uint32_t data = core_fifo[self].data[core_fifo[self].head];
+    core_fifo[self].head = (core_fifo[self].head + 1) % 8;
+    core_fifo[self].count--;
+    sim_sev();
+    return data;
+}
+
+void multicore_fifo_drain(void)
+{
+    core_fifo[sim_core].count = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Tempo
+
+static systick_hw_t sim_systick[2];
+
+systick_hw_t *sim_systick_hw(void)
+{
+    systick_hw_t *st = &sim_systick[sim_core];
+    uint64_t cycles = now_ns * (SIM_CLK_SYS_HZ / 1000000) / 1000;
+    st->cvr = (uint32_t)(0xffffffu - cycles % 0x1000000u);
+    return st;
+}
+
+uint64_t time_us_64(void)
+{
+    return now_ns / 1000;
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)time_us_64();
+}
+
+// Tempo gasto em espera ativa por núcleo; sleep e WFE contam como ociosos.
+static uint64_t busy_ns[2];
+
+void sim_busy_wait_until(uint64_t t_ns)
+{
+    uint self = sim_core;
+    uint64_t start = now_ns;
+    sim_advance_to(t_ns);
+    busy_ns[self] += now_ns - start;
+}
+
+uint64_t sim_busy_ns(unsigned int core)
+{
+    return busy_ns[core];
+}
+
+void busy_wait_us(uint64_t delay_us)
+{
+    sim_busy_wait_until(now_ns + delay_us * 1000);
+}
+
+void busy_wait_us_32(uint32_t delay_us)
+{
+    busy_wait_us(delay_us);
+}
+
+void busy_wait_ms(uint32_t delay_ms)
+{
+    busy_wait_us((uint64_t)delay_ms * 1000);
+}
+
+void sleep_us(uint64_t us)
+{
+    sim_advance_to(now_ns + us * 1000);
+}
+
+void sleep_ms(uint32_t ms)
+{
+    sleep_us((uint64_t)ms * 1000);
+}
+
+void sleep_until(absolute_time_t target)
+{
+    if (target * 1000 > now_ns)
+        sim_advance_to(target * 1000);
+}
+
+void tight_loop_contents(void)
+{
+    uint64_t t;
+    if (sim_next_event(&t) && t > now_ns)
+        sim_busy_wait_until(t);
+    else
+        sim_busy_wait_until(now_ns + 1000);
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout_timestamp)
+{
+    // Acorda no próximo evento (interrupção), num SEV do outro núcleo ou no prazo.
+    uint64_t t, wake = timeout_timestamp * 1000;
+    bool timed_out = true;
+    if (sim_next_event(&t) && t < wake)
+    {
+        timed_out = false;
+        wake = t;
+    }
+    core_in_wfe[sim_core] = true;
+    sim_advance_to(wake > now_ns ? wake : now_ns);
+    core_in_wfe[sim_core] = false;
+    return timed_out;
+}
+
+// ---------------------------------------------------------------------------
+// Alarmes (pool padrão do pico_time)
+
+#define SIM_MAX_ALARMS 16
+
+typedef struct
+{
+    bool used;
+    alarm_id_t id;
+    int event;
+    uint64_t target_us;
+    alarm_callback_t callback;
+    void *user_data;
+} sim_alarm_t;
+
+static sim_alarm_t alarms[SIM_MAX_ALARMS];
+static alarm_id_t next_alarm_id = 1;
+
+static void alarm_fire(void *arg)
+{
+    sim_alarm_t *a = arg;
+    int64_t ret = a->callback(a->id, a->user_data);
+    if (ret == 0 || !a->used)
+    {
+        a->used = false;
+        return;
+    }
+    // > 0: a partir de agora; < 0: a partir do alvo anterior (como no SDK).
+    a->target_us = ret > 0 ? time_us_64() + (uint64_t)ret : a->target_us + (uint64_t)(-ret);
+    a->event = sim_schedule(a->target_us * 1000, alarm_fire, a);
+}
+
+alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    if (time <= time_us_64())
+    {
+        if (!fire_if_past)
+            return 0;
+        time = time_us_64();
+    }
+    for (int i = 0; i < SIM_MAX_ALARMS; i++)
+    {
+        sim_alarm_t *a = &alarms[i];
+        if (!a->used)
+        {
+            *a = (sim_alarm_t){true, next_alarm_id++, 0, time, callback, user_data};
+            a->event = sim_schedule(time * 1000, alarm_fire, a);
+            return a->id;
+        }
+    }
+    return -1;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    return add_alarm_at(time_us_64() + us, callback, user_data, fire_if_past);
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    return add_alarm_in_us((uint64_t)ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id)
+{
+    for (int i = 0; i < SIM_MAX_ALARMS; i++)
+    {
+        sim_alarm_t *a = &alarms[i];
+        if (a->used && a->id == alarm_id)
+        {
+            a->used = false;
+            return sim_cancel(a->event);
+        }
+    }
+    return false;
+}
+
+struct alarm_pool
+{
+    int hardware_alarm;
+};
+
+alarm_pool_t *alarm_pool_create_with_unused_hardware_alarm(uint max_timers)
+{
+    (void)max_timers;
+    alarm_pool_t *pool = malloc(sizeof(*pool));
+    pool->hardware_alarm = hardware_alarm_claim_unused(true);
+    return pool;
+}
+
+alarm_id_t alarm_pool_add_alarm_in_us(alarm_pool_t *pool, uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    (void)pool;
+    return add_alarm_in_us(us, callback, user_data, fire_if_past);
+}
+
+bool alarm_pool_cancel_alarm(alarm_pool_t *pool, alarm_id_t alarm_id)
+{
+    (void)pool;
+    return cancel_alarm(alarm_id);
+}
+
+// ---------------------------------------------------------------------------
+// Alarmes de hardware (TIMER_IRQ_0..3)
+
+static struct
+{
+    bool claimed;
+    int event;
+    hardware_alarm_callback_t callback;
+} hw_alarms[NUM_TIMERS];
+
+static void hw_alarm_fire(void *arg)
+{
+    uint alarm_num = (uint)(uintptr_t)arg;
+    hw_alarms[alarm_num].event = 0;
+    if (hw_alarms[alarm_num].callback)
+        hw_alarms[alarm_num].callback(alarm_num);
+}
+
+void hardware_alarm_claim(uint alarm_num)
+{
+    if (hw_alarms[alarm_num].claimed)
+    {
+        fprintf(stderr, "sim: alarme de hardware %u já em uso\n", alarm_num);
+        abort();
+    }
+    hw_alarms[alarm_num].claimed = true;
+}
+
+int hardware_alarm_claim_unused(bool required)
+{
+    // O alarme 3 fica com o pool padrão do pico_time, como no SDK.
+    for (uint i = 0; i < NUM_TIMERS - 1; i++)
+    {
+        if (!hw_alarms[i].claimed)
+        {
+            hw_alarms[i].claimed = true;
+            return (int)i;
+        }
+    }
+    if (required)
+    {
+        fprintf(stderr, "sim: sem alarme de hardware livre\n");
+        abort();
+    }
+    return -1;
+}
+
+void hardware_alarm_unclaim(uint alarm_num)
+{
+    hardware_alarm_cancel(alarm_num);
+    hw_alarms[alarm_num].claimed = false;
+}
+
+void hardware_alarm_set_callback(uint alarm_num, hardware_alarm_callback_t callback)
+{
+    hw_alarms[alarm_num].callback = callback;
+}
+
+bool hardware_alarm_set_target(uint alarm_num, absolute_time_t t)
+{
+    hardware_alarm_cancel(alarm_num);
+    if (t * 1000 <= now_ns)
+        return true;
+    hw_alarms[alarm_num].event = sim_schedule(t * 1000, hw_alarm_fire, (void *)(uintptr_t)alarm_num);
+    return false;
+}
+
+void hardware_alarm_cancel(uint alarm_num)
+{
+    if (hw_alarms[alarm_num].event)
+        sim_cancel(hw_alarms[alarm_num].event);
+    hw_alarms[alarm_num].event = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Interrupções
+
+#define SIM_MAX_SHARED_HANDLERS 4
+
+static irq_handler_t irq_handlers[NUM_IRQS][SIM_MAX_SHARED_HANDLERS];
+static bool irq_enabled[NUM_IRQS];
+
+void irq_set_enabled(uint num, bool enabled)
+{
+    irq_enabled[num] = enabled;
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler)
+{
+    irq_handlers[num][0] = handler;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority)
+{
+    (void)order_priority;
+    for (int i = 0; i < SIM_MAX_SHARED_HANDLERS; i++)
+    {
+        if (!irq_handlers[num][i])
+        {
+            irq_handlers[num][i] = handler;
+            return;
+        }
+    }
+    fprintf(stderr, "sim: sem espaço para handler na IRQ %u\n", num);
+    abort();
+}
+
+void irq_remove_handler(uint num, irq_handler_t handler)
+{
+    for (int i = 0; i < SIM_MAX_SHARED_HANDLERS; i++)
+        if (irq_handlers[num][i] == handler)
+            irq_handlers[num][i] = NULL;
+}
+
+void irq_set_priority(uint num, uint8_t hardware_priority)
+{
+    (void)num;
+    (void)hardware_priority;
+}
+
+void sim_irq_raise(unsigned int num)
+{
+    if (!irq_enabled[num])
+        return;
+    for (int i = 0; i < SIM_MAX_SHARED_HANDLERS; i++)
+        if (irq_handlers[num][i])
+            irq_handlers[num][i]();
+}
+
+// ---------------------------------------------------------------------------
+// GPIO e stdio
+
+static uint32_t gpio_out_mask;
+static uint32_t gpio_out_level;
+static uint32_t gpio_in_level;
+
+// Chaves (ex.: teclas da matriz) ligando pares de pinos.
+static uint32_t gpio_contacts[NUM_BANK0_GPIOS];
+
+// Interrupções de GPIO: eventos habilitados por pino e pendentes de entrega.
+static uint32_t gpio_irq_mask[NUM_BANK0_GPIOS];
+static uint32_t gpio_irq_pending[NUM_BANK0_GPIOS];
+static gpio_irq_callback_t gpio_callback;
+static int gpio_irq_event;
+
+static void gpio_irq_dispatch(void *arg)
+{
+    (void)arg;
+    gpio_irq_event = 0;
+    for (uint gpio = 0; gpio < NUM_BANK0_GPIOS; gpio++)
+    {
+        uint32_t events = gpio_irq_pending[gpio] & gpio_irq_mask[gpio];
+        gpio_irq_pending[gpio] = 0;
+        if (events && gpio_callback && irq_enabled[IO_IRQ_BANK0])
+            gpio_callback(gpio, events);
+    }
+}
+
+// Recalcula as entradas a partir das saídas e das chaves; bordas viram IRQ.
+static void gpio_update(void)
+{
+    uint32_t driven = gpio_out_level & gpio_out_mask;
+    uint32_t level = 0;
+    for (uint gpio = 0; gpio < NUM_BANK0_GPIOS; gpio++)
+        if (gpio_contacts[gpio] & driven)
+            level |= 1u << gpio;
+    level &= ~gpio_out_mask;
+
+    uint32_t rise = level & ~gpio_in_level;
+    uint32_t fall = gpio_in_level & ~level;
+    gpio_in_level = level;
+
+    bool any = false;
+    for (uint gpio = 0; gpio < NUM_BANK0_GPIOS; gpio++)
+    {
+        if (rise & (1u << gpio))
+            gpio_irq_pending[gpio] |= GPIO_IRQ_EDGE_RISE;
+        if (fall & (1u << gpio))
+            gpio_irq_pending[gpio] |= GPIO_IRQ_EDGE_FALL;
+        any |= (gpio_irq_pending[gpio] & gpio_irq_mask[gpio]) != 0;
+    }
+    // Entregue como interrupção: depois do código atual, no próximo avanço do relógio.
+    if (any && !gpio_irq_event)
+        gpio_irq_event = sim_schedule(now_ns, gpio_irq_dispatch, NULL);
+}
+
+void sim_gpio_connect(unsigned int a, unsigned int b, bool closed)
+{
+    if (closed)
+    {
+        gpio_contacts[a] |= 1u << b;
+        gpio_contacts[b] |= 1u << a;
+    }
+    else
+    {
+        gpio_contacts[a] &= ~(1u << b);
+        gpio_contacts[b] &= ~(1u << a);
+    }
+    gpio_update();
+}
+
+bool sim_gpio_contact(unsigned int a, unsigned int b)
+{
+    return (gpio_contacts[a] >> b) & 1u;
+}
+
+void gpio_init(uint gpio)
+{
+    gpio_out_mask &= ~(1u << gpio);
+    gpio_out_level &= ~(1u << gpio);
+    gpio_update();
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+    if (out)
+        gpio_out_mask |= 1u << gpio;
+    else
+        gpio_out_mask &= ~(1u << gpio);
+    gpio_update();
+}
+
+void gpio_put(uint gpio, bool value)
+{
+    gpio_put_masked(1u << gpio, value ? 1u << gpio : 0);
+}
+
+void gpio_put_masked(uint32_t mask, uint32_t value)
+{
+    gpio_out_level = (gpio_out_level & ~mask) | (value & mask);
+    gpio_update();
+}
+
+bool gpio_get(uint gpio)
+{
+    return (gpio_get_all() >> gpio) & 1u;
+}
+
+uint32_t gpio_get_all(void)
+{
+    return (gpio_out_level & gpio_out_mask) | gpio_in_level;
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn)
+{
+    (void)gpio;
+    (void)fn;
+}
+
+void gpio_pull_up(uint gpio)
+{
+    (void)gpio;
+}
+
+void gpio_pull_down(uint gpio)
+{
+    (void)gpio;
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t events)
+{
+    gpio_irq_pending[gpio] &= ~events;
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled)
+{
+    // Como no SDK: descarta bordas antigas antes de habilitar.
+    gpio_acknowledge_irq(gpio, events);
+    if (enabled)
+        gpio_irq_mask[gpio] |= events;
+    else
+        gpio_irq_mask[gpio] &= ~events;
+}
+
+void gpio_set_irq_callback(gpio_irq_callback_t callback)
+{
+    gpio_callback = callback;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, gpio_irq_callback_t callback)
+{
+    gpio_set_irq_enabled(gpio, events, enabled);
+    gpio_set_irq_callback(callback);
+    if (enabled)
+        irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+bool stdio_init_all(void)
+{
+    return true;
+}
+
+// Tempo que cada printf segura o núcleo, como o stdio USB quando o host demora a ler.
+static uint32_t stdio_stall_us = 0;
+
+void sim_set_stdio_stall_us(uint32_t us)
+{
+    stdio_stall_us = us;
+}
+
+#undef printf
+int sim_printf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    if (stdio_stall_us)
+        busy_wait_us(stdio_stall_us);
+    return n;
+}
+
+// Entrada do stdio: fila circular preenchida pelo roteiro (sim_stdin_push).
+#define SIM_STDIN_SIZE 256
+
+static char stdin_buf[SIM_STDIN_SIZE];
+static uint stdin_head = 0, stdin_tail = 0;
+
+size_t sim_stdin_free(void)
+{
+    return (stdin_tail + SIM_STDIN_SIZE - stdin_head - 1) % SIM_STDIN_SIZE;
+}
+
+size_t sim_stdin_write(const void *buf, size_t len)
+{
+    const uint8_t *b = buf;
+    size_t n = 0;
+    for (; n < len && sim_stdin_free(); n++)
+    {
+        stdin_buf[stdin_head] = b[n];
+        stdin_head = (stdin_head + 1) % SIM_STDIN_SIZE;
+    }
+    return n;
+}
+
+void sim_stdin_push(const char *s)
+{
+    size_t len = strlen(s);
+    if (sim_stdin_write(s, len) < len)
+        fprintf(stderr, "sim: entrada do stdio cheia\n");
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    // Sem eventos por caractere: com timeout, só olha de novo no fim da espera.
+    if (stdin_head == stdin_tail && timeout_us)
+        sleep_us(timeout_us);
+    if (stdin_head == stdin_tail)
+        return PICO_ERROR_TIMEOUT;
+    char c = stdin_buf[stdin_tail];
+    stdin_tail = (stdin_tail + 1) % SIM_STDIN_SIZE;
+    return (unsigned char)c;
+}
+
+void rom_reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask)
+{
+    (void)usb_activity_gpio_pin_mask;
+    (void)disable_interface_mask;
+    fprintf(stderr, "sim: reinício no modo BOOTSEL\n");
+    exit(0);
+}
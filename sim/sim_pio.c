@@ -0,0 +1,754 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+
+pio_hw_t sim_pio_hw[NUM_PIOS];
+
+// O WS2812 trava o quadro após >= 50us de linha em nível baixo.
+#define SIM_LATCH_NS 50000u
+
+// Ciclos da PIO por bit transmitido nos programas ws2818b.
+#define SIM_CYCLES_PER_BIT 10u
+
+#define SIM_MAX_FRAME_BYTES 4096
+#define SIM_MAX_LANES 8
+#define SIM_TX_HISTORY 8
+
+// Ciclos da PIO por varredura do programa keypad sem mudança no mapa.
+#define SIM_KEYPAD_SCAN_CYCLES 1161u
+
+typedef struct
+{
+    bool claimed, enabled;
+    pio_sm_config cfg;
+    uint pin;
+    uint lanes;     // Linhas de dados (1, ou uma por fita no programa paralelo).
+    uint slot_bits; // Bits da palavra consumidos por tempo de bit.
+    uint64_t bit_ns;
+    uint64_t line_free_ns; // Fim do último bit já agendado na linha.
+    int stall_event;       // Parada no autopull, no fim do último bit (TXSTALL).
+    uint64_t pull_ns[SIM_TX_HISTORY]; // Instante do pull das últimas palavras.
+    uint64_t pushed;
+    uint8_t frame[SIM_MAX_LANES][SIM_MAX_FRAME_BYTES];
+    size_t frame_bits;
+    // O que a fita mostra: cada quadro sobrescreve só o começo, e os LEDs além dele
+    // mantêm a cor travada antes (quadros truncados).
+    uint8_t shown[SIM_MAX_LANES][SIM_MAX_FRAME_BYTES];
+    size_t shown_len;
+    // Programa keypad: varredura periódica da matriz de chaves.
+    bool keypad;
+    uint64_t scan_ns;
+    int scan_event;
+    uint32_t last_map; // Registrador x.
+    bool stalled;      // Parada em "push block" com a FIFO RX cheia.
+    uint32_t rx[8];
+    uint rx_head, rx_count;
+} sim_sm_t;
+
+static sim_sm_t sms[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+static uint64_t tx_words = 0, tx_bytes = 0;
+static uint32_t pio_inte0[NUM_PIOS];
+static uint pio_used_instructions[NUM_PIOS];
+static sim_frame_hook_t frame_hook = NULL;
+
+void sim_set_frame_hook(sim_frame_hook_t hook)
+{
+    frame_hook = hook;
+}
+
+static sim_sm_t *sm_of(PIO pio, uint sm)
+{
+    return &sms[pio_get_index(pio)][sm];
+}
+
+static uint tx_depth(const sim_sm_t *s)
+{
+    return s->cfg.join == PIO_FIFO_JOIN_TX ? 8 : 4;
+}
+
+// Palavras ainda na FIFO (não puxadas para o OSR) no instante atual.
+static uint tx_level(const sim_sm_t *s)
+{
+    uint64_t now = sim_time_ns();
+    uint depth = tx_depth(s);
+    uint level = 0;
+    for (uint64_t k = s->pushed > depth ? s->pushed - depth : 0; k < s->pushed; k++)
+        if (s->pull_ns[k % SIM_TX_HISTORY] > now)
+            level++;
+    return level;
+}
+
+static void latch(sim_sm_t *s)
+{
+    size_t len = s->frame_bits / 8;
+    if (len > s->shown_len)
+        s->shown_len = len;
+    for (uint l = 0; l < s->lanes; l++)
+    {
+        memcpy(s->shown[l], s->frame[l], len);
+        if (frame_hook)
+            frame_hook(s->pin + l, s->shown[l], s->shown_len, s->line_free_ns);
+    }
+    s->frame_bits = 0;
+}
+
+static uint word_bits(const sim_sm_t *s)
+{
+    return s->cfg.pull_threshold ? s->cfg.pull_threshold : 32;
+}
+
+void sim_pio_flush(bool force)
+{
+    uint64_t now = sim_time_ns();
+    for (uint p = 0; p < NUM_PIOS; p++)
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++)
+        {
+            sim_sm_t *s = &sms[p][i];
+            if (s->frame_bits && (force || now >= s->line_free_ns + SIM_LATCH_NS))
+                latch(s);
+        }
+}
+
+// Decodifica os bits de uma palavra como o WS2812 os recebe (MSB primeiro por byte).
+// Cada tempo de bit consome slot_bits bits da palavra; o bit l do grupo vai para a linha l.
+static void shift_out(sim_sm_t *s, uint32_t word)
+{
+    uint nslots = word_bits(s) / s->slot_bits;
+    uint32_t mask = s->slot_bits >= 32 ? ~0u : (1u << s->slot_bits) - 1;
+    for (uint k = 0; k < nslots; k++)
+    {
+        uint32_t slot = s->cfg.out_shift_right ? (word >> (k * s->slot_bits)) & mask
+                                               : (word >> (32 - (k + 1) * s->slot_bits)) & mask;
+        size_t byte = s->frame_bits / 8;
+        if (byte >= SIM_MAX_FRAME_BYTES)
+            return;
+        for (uint l = 0; l < s->lanes; l++)
+        {
+            if (s->frame_bits % 8 == 0)
+                s->frame[l][byte] = 0;
+            s->frame[l][byte] |= ((slot >> l) & 1u) << (7 - s->frame_bits % 8);
+        }
+        s->frame_bits++;
+    }
+}
+
+static uint32_t txstall_bit(const sim_sm_t *s, uint *p)
+{
+    uint i = s - &sms[0][0];
+    *p = i / NUM_PIO_STATE_MACHINES;
+    return 1u << (PIO_FDEBUG_TXSTALL_LSB + i % NUM_PIO_STATE_MACHINES);
+}
+
+static void tx_stall(void *arg)
+{
+    sim_sm_t *s = arg;
+    uint p;
+    uint32_t bit = txstall_bit(s, &p);
+    s->stall_event = 0;
+    sim_pio_hw[p].fdebug |= bit;
+}
+
+// O firmware limpa TXSTALL escrevendo 1; com a máquina ocupada o bit volta a 0, como no
+// RP2040, em que ele só é marcado de novo quando a máquina para. Chamado após as interrupções.
+static void sim_pio_fdebug_sync(void)
+{
+    for (uint p = 0; p < NUM_PIOS; p++)
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++)
+            if (sms[p][i].stall_event)
+                sim_pio_hw[p].fdebug &= ~(1u << (PIO_FDEBUG_TXSTALL_LSB + i));
+}
+
+uint64_t sim_pio_tx_push(struct pio_hw *pio, unsigned int sm, uint32_t word, uint64_t earliest_ns)
+{
+    sim_sm_t *s = sm_of(pio, sm);
+    uint depth = tx_depth(s);
+
+    // Com a FIFO cheia, a palavra só entra quando a de "depth" posições atrás for puxada.
+    uint64_t enter = earliest_ns;
+    if (s->pushed >= depth && s->pull_ns[(s->pushed - depth) % SIM_TX_HISTORY] > enter)
+        enter = s->pull_ns[(s->pushed - depth) % SIM_TX_HISTORY];
+
+    uint64_t pull = enter > s->line_free_ns ? enter : s->line_free_ns;
+    if (s->frame_bits && pull >= s->line_free_ns + SIM_LATCH_NS)
+        latch(s);
+
+    s->pull_ns[s->pushed % SIM_TX_HISTORY] = pull;
+    s->pushed++;
+    tx_words++;
+    tx_bytes += (word_bits(s) + 7) / 8;
+    shift_out(s, word);
+    s->line_free_ns = pull + word_bits(s) / s->slot_bits * s->bit_ns;
+
+    // A parada só acontece depois da última palavra.
+    uint p;
+    uint32_t bit = txstall_bit(s, &p);
+    sim_pio_hw[p].fdebug &= ~bit;
+    if (s->stall_event)
+        sim_cancel(s->stall_event);
+    s->stall_event = sim_schedule(s->line_free_ns, tx_stall, s);
+    return enter;
+}
+
+void sim_pio_tx_counters(uint64_t *words, uint64_t *bytes)
+{
+    *words = tx_words;
+    *bytes = tx_bytes;
+}
+
+bool sim_pio_tx_target(volatile void *addr, struct pio_hw **pio, unsigned int *sm)
+{
+    for (uint p = 0; p < NUM_PIOS; p++)
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++)
+            if (addr == (volatile void *)&sim_pio_hw[p].txf[i])
+            {
+                *pio = &sim_pio_hw[p];
+                *sm = i;
+                return true;
+            }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// FIFO RX e programa keypad
+
+static uint rx_depth(const sim_sm_t *s)
+{
+    return s->cfg.join == PIO_FIFO_JOIN_RX ? 8 : 4;
+}
+
+static bool rx_push(sim_sm_t *s, uint32_t word)
+{
+    if (s->rx_count == rx_depth(s))
+        return false;
+    s->rx[(s->rx_head + s->rx_count++) % 8] = word;
+
+    uint index = (uint)(s - &sms[0][0]);
+    uint p = index / NUM_PIO_STATE_MACHINES, sm = index % NUM_PIO_STATE_MACHINES;
+    if (pio_inte0[p] & (1u << (pis_sm0_rx_fifo_not_empty + sm)))
+        sim_irq_raise(p ? PIO1_IRQ_0 : PIO0_IRQ_0);
+    return true;
+}
+
+// Uma varredura completa: o mapa sai da matriz de chaves (sim_gpio_connect), linha r e
+// coluna c no bit 16 + 4r + c, e só entra na FIFO quando muda.
+static void keypad_scan(void *arg)
+{
+    sim_sm_t *s = arg;
+    s->scan_event = 0;
+    if (!s->enabled)
+        return;
+
+    uint32_t map = 0;
+    for (uint r = 0; r < 4; r++)
+        for (uint c = 0; c < 4; c++)
+            if (sim_gpio_contact(s->cfg.set_base + r, s->cfg.in_base + c))
+                map |= 1u << (16 + 4 * r + c);
+
+    if (map != s->last_map)
+    {
+        s->last_map = map;
+        if (!rx_push(s, map))
+        {
+            s->stalled = true;
+            return;
+        }
+    }
+    s->scan_event = sim_schedule(sim_time_ns() + s->scan_ns, keypad_scan, s);
+}
+
+// ---------------------------------------------------------------------------
+// Configuração
+
+pio_sm_config pio_get_default_sm_config(void)
+{
+    pio_sm_config c;
+    memset(&c, 0, sizeof(c));
+    c.out_shift_right = true;
+    c.in_shift_right = true;
+    c.clkdiv = 1.f;
+    c.wrap = 31;
+    return c;
+}
+
+void sm_config_set_out_pins(pio_sm_config *c, uint out_base, uint out_count)
+{
+    c->out_base = out_base;
+    c->out_count = out_count;
+}
+
+void sm_config_set_set_pins(pio_sm_config *c, uint set_base, uint set_count)
+{
+    c->set_base = set_base;
+    c->set_count = set_count;
+}
+
+void sm_config_set_in_pins(pio_sm_config *c, uint in_base)
+{
+    c->in_base = in_base;
+}
+
+void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base)
+{
+    c->sideset_base = sideset_base;
+}
+
+void sm_config_set_sideset(pio_sm_config *c, uint bit_count, bool optional, bool pindirs)
+{
+    (void)optional;
+    (void)pindirs;
+    c->sideset_count = bit_count;
+}
+
+void sm_config_set_jmp_pin(pio_sm_config *c, uint pin)
+{
+    c->jmp_pin = pin;
+}
+
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold)
+{
+    c->out_shift_right = shift_right;
+    c->autopull = autopull;
+    c->pull_threshold = pull_threshold & 31u;
+}
+
+void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush, uint push_threshold)
+{
+    c->in_shift_right = shift_right;
+    c->autopush = autopush;
+    c->push_threshold = push_threshold & 31u;
+}
+
+void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join)
+{
+    c->join = join;
+}
+
+void sm_config_set_clkdiv(pio_sm_config *c, float div)
+{
+    c->clkdiv = div;
+}
+
+void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap)
+{
+    c->wrap_target = wrap_target;
+    c->wrap = wrap;
+}
+
+// ---------------------------------------------------------------------------
+// Blocos e máquinas de estado
+
+uint pio_get_index(PIO pio)
+{
+    return pio == pio1 ? 1 : 0;
+}
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+    uint base = pio_get_index(pio) ? (is_tx ? DREQ_PIO1_TX0 : DREQ_PIO1_RX0) : (is_tx ? DREQ_PIO0_TX0 : DREQ_PIO0_RX0);
+    return base + sm;
+}
+
+bool pio_can_add_program(PIO pio, const pio_program_t *program)
+{
+    return pio_used_instructions[pio_get_index(pio)] + program->length <= PIO_INSTRUCTION_COUNT;
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program)
+{
+    if (!pio_can_add_program(pio, program))
+    {
+        fprintf(stderr, "sim: sem espaço de instruções na PIO%u\n", pio_get_index(pio));
+        abort();
+    }
+    uint offset = pio_used_instructions[pio_get_index(pio)];
+    pio_used_instructions[pio_get_index(pio)] += program->length;
+    return offset;
+}
+
+void pio_remove_program(PIO pio, const pio_program_t *program, uint loaded_offset)
+{
+    (void)pio;
+    (void)program;
+    (void)loaded_offset;
+}
+
+void pio_gpio_init(PIO pio, uint pin)
+{
+    (void)pio;
+    (void)pin;
+}
+
+void pio_sm_claim(PIO pio, uint sm)
+{
+    sm_of(pio, sm)->claimed = true;
+}
+
+int pio_claim_unused_sm(PIO pio, bool required)
+{
+    for (uint i = 0; i < NUM_PIO_STATE_MACHINES; i++)
+    {
+        if (!sm_of(pio, i)->claimed)
+        {
+            sm_of(pio, i)->claimed = true;
+            return (int)i;
+        }
+    }
+    if (required)
+    {
+        fprintf(stderr, "sim: nenhuma máquina livre na PIO%u\n", pio_get_index(pio));
+        abort();
+    }
+    return -1;
+}
+
+void pio_sm_unclaim(PIO pio, uint sm)
+{
+    sm_of(pio, sm)->claimed = false;
+}
+
+int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config)
+{
+    (void)initial_pc;
+    sim_sm_t *s = sm_of(pio, sm);
+    s->cfg = *config;
+    s->enabled = false;
+    s->pin = config->sideset_count ? config->sideset_base : config->out_base;
+    s->lanes = 1;
+    s->slot_bits = 1;
+    if (config->program && strcmp(config->program, "ws2818b_parallel") == 0)
+    {
+        // "out x, 8" por tempo de bit; "mov pins, x" leva o bit l ao pino base + l.
+        s->lanes = config->out_count > SIM_MAX_LANES ? SIM_MAX_LANES : config->out_count;
+        s->slot_bits = 8;
+    }
+    s->bit_ns = (uint64_t)(config->clkdiv * SIM_CYCLES_PER_BIT * 1e9f / SIM_CLK_SYS_HZ + 0.5f);
+    s->keypad = config->program && strcmp(config->program, "keypad") == 0;
+    s->scan_ns = (uint64_t)(config->clkdiv * SIM_KEYPAD_SCAN_CYCLES * 1e9f / SIM_CLK_SYS_HZ + 0.5f);
+    s->last_map = 0;
+    s->stalled = false;
+    s->rx_count = 0;
+    s->line_free_ns = sim_time_ns();
+    s->pushed = 0;
+    s->frame_bits = 0;
+    return 0;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    sim_sm_t *s = sm_of(pio, sm);
+    s->enabled = enabled;
+    if (s->keypad && enabled && !s->scan_event && !s->stalled)
+        s->scan_event = sim_schedule(sim_time_ns() + s->scan_ns, keypad_scan, s);
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out)
+{
+    (void)pio;
+    (void)sm;
+    (void)pin_base;
+    (void)pin_count;
+    (void)is_out;
+}
+
+void pio_sm_clear_fifos(PIO pio, uint sm)
+{
+    sim_sm_t *s = sm_of(pio, sm);
+    for (uint k = 0; k < SIM_TX_HISTORY; k++)
+        if (s->pull_ns[k] > sim_time_ns())
+            s->pull_ns[k] = sim_time_ns();
+}
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data)
+{
+    sim_sm_t *s = sm_of(pio, sm);
+    if (tx_level(s) < tx_depth(s))
+        sim_pio_tx_push(pio, sm, data, sim_time_ns());
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+    uint64_t enter = sim_pio_tx_push(pio, sm, data, sim_time_ns());
+    if (enter > sim_time_ns())
+        sim_busy_wait_until(enter);
+}
+
+uint32_t pio_sm_get(PIO pio, uint sm)
+{
+    sim_sm_t *s = sm_of(pio, sm);
+    if (!s->rx_count)
+        return 0;
+    uint32_t word = s->rx[s->rx_head];
+    s->rx_head = (s->rx_head + 1) % 8;
+    s->rx_count--;
+
+    // Libera o "push block" parado e retoma as varreduras.
+    if (s->stalled)
+    {
+        s->stalled = false;
+        rx_push(s, s->last_map);
+        s->scan_event = sim_schedule(sim_time_ns() + s->scan_ns, keypad_scan, s);
+    }
+    return word;
+}
+
+uint32_t pio_sm_get_blocking(PIO pio, uint sm)
+{
+    return pio_sm_get(pio, sm);
+}
+
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm)
+{
+    sim_sm_t *s = sm_of(pio, sm);
+    return tx_level(s) >= tx_depth(s);
+}
+
+bool pio_sm_is_tx_fifo_empty(PIO pio, uint sm)
+{
+    return tx_level(sm_of(pio, sm)) == 0;
+}
+
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm)
+{
+    return tx_level(sm_of(pio, sm));
+}
+
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm)
+{
+    return sm_of(pio, sm)->rx_count == 0;
+}
+
+void pio_set_irq0_source_enabled(PIO pio, enum pio_interrupt_source source, bool enabled)
+{
+    if (enabled)
+        pio_inte0[pio_get_index(pio)] |= 1u << source;
+    else
+        pio_inte0[pio_get_index(pio)] &= ~(1u << source);
+}
+
+// ---------------------------------------------------------------------------
+// DMA
+
+typedef struct
+{
+    bool claimed, busy;
+    dma_channel_config cfg;
+    const volatile uint8_t *read;
+    volatile uint8_t *write;
+    uint32_t count;
+    int event;
+} sim_dma_t;
+
+static sim_dma_t dma[NUM_DMA_CHANNELS];
+static uint32_t dma_inte0, dma_ints0;
+
+static void dma_trigger(uint ch);
+
+static void dma_done(void *arg)
+{
+    uint ch = (uint)(uintptr_t)arg;
+    sim_dma_t *d = &dma[ch];
+    d->busy = false;
+    if (!d->cfg.irq_quiet)
+        dma_ints0 |= 1u << ch;
+    if (d->cfg.chain_to != ch)
+        dma_trigger(d->cfg.chain_to);
+    if (dma_ints0 & dma_inte0 & (1u << ch))
+    {
+        sim_irq_raise(DMA_IRQ_0);
+        sim_pio_fdebug_sync();
+    }
+}
+
+static uint32_t dma_read_element(const volatile uint8_t *p, uint size)
+{
+    // Escritas estreitas são replicadas nas faixas do barramento, como no RP2040.
+    if (size == 1)
+        return *p * 0x01010101u;
+    if (size == 2)
+    {
+        uint16_t v;
+        memcpy(&v, (const void *)p, 2);
+        return v * 0x00010001u;
+    }
+    uint32_t v;
+    memcpy(&v, (const void *)p, 4);
+    return v;
+}
+
+static void dma_trigger(uint ch)
+{
+    sim_dma_t *d = &dma[ch];
+    uint size = 1u << d->cfg.size;
+    uint64_t t = sim_time_ns();
+    PIO pio;
+    uint sm;
+    bool to_pio = sim_pio_tx_target(d->write, &pio, &sm);
+
+    d->busy = true;
+    for (uint32_t i = 0; i < d->count; i++)
+    {
+        uint32_t v = dma_read_element(d->read, size);
+        if (to_pio)
+            t = sim_pio_tx_push(pio, sm, v, t);
+        else
+        {
+            memcpy((void *)d->write, &v, size);
+            t += 8; // ~1 transferência por ciclo de 125 MHz.
+        }
+        if (d->cfg.read_increment)
+            d->read += size;
+        if (d->cfg.write_increment)
+            d->write += size;
+    }
+    d->event = sim_schedule(t, dma_done, (void *)(uintptr_t)ch);
+}
+
+void dma_channel_claim(uint channel)
+{
+    dma[channel].claimed = true;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    for (uint i = 0; i < NUM_DMA_CHANNELS; i++)
+    {
+        if (!dma[i].claimed)
+        {
+            dma[i].claimed = true;
+            return (int)i;
+        }
+    }
+    if (required)
+    {
+        fprintf(stderr, "sim: nenhum canal DMA livre\n");
+        abort();
+    }
+    return -1;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+    dma[channel].claimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    dma_channel_config c = {DMA_SIZE_32, true, false, DREQ_FORCE, channel, false, false, true};
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->write_increment = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+    c->dreq = dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+    c->chain_to = chain_to;
+}
+
+void channel_config_set_bswap(dma_channel_config *c, bool bswap)
+{
+    c->bswap = bswap;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger)
+{
+    sim_dma_t *d = &dma[channel];
+    d->cfg = *config;
+    d->write = write_addr;
+    d->read = read_addr;
+    d->count = transfer_count;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger)
+{
+    dma[channel].read = read_addr;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger)
+{
+    dma[channel].write = write_addr;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger)
+{
+    dma[channel].count = trans_count;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count)
+{
+    dma[channel].read = read_addr;
+    dma[channel].count = transfer_count;
+    dma_trigger(channel);
+}
+
+void dma_channel_start(uint channel)
+{
+    dma_trigger(channel);
+}
+
+void dma_channel_abort(uint channel)
+{
+    if (dma[channel].busy)
+        sim_cancel(dma[channel].event);
+    dma[channel].busy = false;
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+    return dma[channel].busy;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel)
+{
+    while (dma[channel].busy)
+        tight_loop_contents();
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+    if (enabled)
+        dma_inte0 |= 1u << channel;
+    else
+        dma_inte0 &= ~(1u << channel);
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+    return dma_ints0 & (1u << channel);
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+    dma_ints0 &= ~(1u << channel);
+}
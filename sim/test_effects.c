@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "efeitos.h"
+#include "neopixel_gamma.h"
+
+/*
+ * Compara os efeitos da tabela de efeitos.c com as animações originais (test_effects.ref):
+ * cada efeito roda sozinho sobre a HAL simulada, do quadro apagado até o fim, e o estado
+ * travado nos LEDs é conferido no meio de cada quadro da referência (os bytes da linha
+ * devem ser os da referência depois da gama). A sequência de estados distintos também
+ * deve ser a mesma: nenhum quadro a mais ou a menos.
+ *
+ * Uso: test_effects test_effects.ref
+ */
+
+#define TEST_LED_PIN 7
+#define TEST_FRAMES_MAX 64
+#define TEST_LATCHES_MAX 4096
+#define TEST_FRAME_BYTES (LED_COUNT * 3)
+
+// Quadro no meio do intervalo até o próximo, sem passar de metade disto (e o último também).
+#define TEST_SAMPLE_MAX_US 100000
+
+typedef struct
+{
+    uint32_t t_us;
+    uint8_t grb[TEST_FRAME_BYTES];
+} test_frame_t;
+
+static test_frame_t ref[TEST_FRAMES_MAX];
+static uint ref_count;
+
+static test_frame_t latched[TEST_LATCHES_MAX];
+static uint latched_count;
+static uint64_t latched_t0_ns;
+
+static void on_frame(unsigned int pin, const uint8_t *bytes, size_t len, uint64_t t_ns)
+{
+    (void)pin;
+    if (latched_count == TEST_LATCHES_MAX || t_ns < latched_t0_ns)
+        return;
+    test_frame_t *f = &latched[latched_count++];
+    memset(f->grb, 0, sizeof(f->grb));
+    memcpy(f->grb, bytes, len < sizeof(f->grb) ? len : sizeof(f->grb));
+    f->t_us = (t_ns - latched_t0_ns) / 1000;
+}
+
+static int hex_nibble(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+// Lê os quadros de uma tecla, já em bytes da linha (GRB depois da gama); 0 se não houver.
+static uint ler_referencia(FILE *in, char key)
+{
+    char line[32 + TEST_FRAME_BYTES * 2];
+    ref_count = 0;
+    rewind(in);
+    while (fgets(line, sizeof(line), in))
+    {
+        char k;
+        unsigned ms;
+        int pos;
+        if (line[0] == '#' || sscanf(line, "%c %u %n", &k, &ms, &pos) != 2 || k != key)
+            continue;
+        if (ref_count == TEST_FRAMES_MAX || strlen(line + pos) < TEST_FRAME_BYTES * 2)
+            return 0;
+        test_frame_t *f = &ref[ref_count++];
+        f->t_us = ms * 1000;
+        for (uint i = 0; i < LED_COUNT; i++)
+        {
+            uint8_t rgb[3];
+            for (uint c = 0; c < 3; c++)
+            {
+                const char *h = line + pos + (i * 3 + c) * 2;
+                int hi = hex_nibble(h[0]), lo = hex_nibble(h[1]);
+                if (hi < 0 || lo < 0)
+                    return 0;
+                rgb[c] = hi << 4 | lo;
+            }
+            f->grb[i * 3] = np_lut8(np_lut, rgb[1]);
+            f->grb[i * 3 + 1] = np_lut8(np_lut, rgb[0]);
+            f->grb[i * 3 + 2] = np_lut8(np_lut, rgb[2]);
+        }
+    }
+    return ref_count;
+}
+
+// Estado travado nos LEDs no instante t_us (o quadro apagado antes do primeiro).
+static const uint8_t *estado_em(uint32_t t_us)
+{
+    static const uint8_t apagado[TEST_FRAME_BYTES];
+    const uint8_t *s = apagado;
+    for (uint i = 0; i < latched_count && latched[i].t_us <= t_us; i++)
+        s = latched[i].grb;
+    return s;
+}
+
+// Quantos estados distintos seguidos há numa sequência de quadros.
+static uint estados_distintos(const test_frame_t *f, uint n)
+{
+    uint count = 0;
+    for (uint i = 0; i < n; i++)
+        if (i == 0 || memcmp(f[i].grb, f[i - 1].grb, TEST_FRAME_BYTES) != 0)
+            count++;
+    return count;
+}
+
+static bool testar_efeito(const efeito_t *e)
+{
+    // Parte de um quadro apagado, já travado.
+    npClear();
+    npWrite();
+    npWait();
+    sim_pio_flush(true);
+    latched_count = 0;
+    latched_t0_ns = sim_time_ns();
+
+    np_player_t p;
+    iniciar_efeito_de(&p, e, time_us_64());
+    npPlayerFinish(&p);
+    npWait();
+    sim_pio_flush(true);
+
+    bool ok = true;
+    for (uint i = 0; i < ref_count; i++)
+    {
+        uint32_t gap = i + 1 < ref_count ? ref[i + 1].t_us - ref[i].t_us : TEST_SAMPLE_MAX_US;
+        uint32_t t = ref[i].t_us + (gap < TEST_SAMPLE_MAX_US ? gap : TEST_SAMPLE_MAX_US) / 2;
+        const uint8_t *s = estado_em(t);
+        for (uint j = 0; j < LED_COUNT && ok; j++)
+        {
+            if (memcmp(s + j * 3, ref[i].grb + j * 3, 3) != 0)
+            {
+                fprintf(stderr, "%s: quadro %u (%u ms), LED %u: GRB %02x%02x%02x, esperado %02x%02x%02x\n",
+                        e->name, i, ref[i].t_us / 1000, j, s[j * 3], s[j * 3 + 1], s[j * 3 + 2],
+                        ref[i].grb[j * 3], ref[i].grb[j * 3 + 1], ref[i].grb[j * 3 + 2]);
+                ok = false;
+            }
+        }
+    }
+
+    uint n_ref = estados_distintos(ref, ref_count), n = estados_distintos(latched, latched_count);
+    if (n != n_ref)
+    {
+        fprintf(stderr, "%s: %u estados distintos nos LEDs, esperado %u\n", e->name, n, n_ref);
+        ok = false;
+    }
+    printf("%s: %u quadros, %s\n", e->name, ref_count, ok ? "ok" : "FALHOU");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "uso: %s test_effects.ref\n", argv[0]);
+        return 2;
+    }
+    FILE *in = fopen(argv[1], "r");
+    if (!in)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+
+    sim_set_frame_hook(on_frame);
+    npInitMode(TEST_LED_PIN, NP_MODE_GRB24);
+
+    uint tested = 0, failed = 0;
+    for (uint i = 0; i < efeitos_count; i++)
+    {
+        if (!ler_referencia(in, efeitos[i].key))
+            continue;
+        tested++;
+        if (!testar_efeito(&efeitos[i]))
+            failed++;
+    }
+    fclose(in);
+
+    if (!tested)
+    {
+        fprintf(stderr, "%s: nenhum quadro de referência\n", argv[1]);
+        return 1;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""Quadros do host pelo pseudoterminal do simulador (opção -p), conferidos no trace.
+
+Roda Animacoes_neopixel_sim -p, escreve no seu terminal como np_stream.py e confere os
+quadros travados nos LEDs contra os enviados (bytes GRB depois da gama):
+  - um cabeçalho com soma errada: os pixels que ele anuncia são descartados, mesmo trazendo
+    um cabeçalho válido e um fim de linha, e o quadro seguinte chega inteiro
+  - um quadro truncado: abandonado depois de NP_STREAM_TIMEOUT_US, sem chegar aos LEDs
+  - texto no meio dos quadros: descartado; depois da transmissão, vira o letreiro
+  - a tecla 2 depois dos quadros: o coração acende o primeiro LED sobre o último quadro do
+    host, não sobre o buffer de trás deixado pelo stream
+
+Os canais usam só valores cuja saída da tabela de gama não tem fração: o simulador roda com
+pontilhamento, e assim cada quadro sai uma vez, com os bytes exatos.
+
+Uso: python3 test_stream.py CAMINHO/Animacoes_neopixel_sim
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+import time
+import tty
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+import neopixel_gamma  # noqa: E402
+from np_stream import header  # noqa: E402
+
+LED_PIN = 7
+LEDS = 25
+BRIGHTNESS = 7  # NP_BRIGHTNESS_DEFAULT
+DITHER_BITS = 4  # NP_DITHER_BITS
+TIMEOUT_S = 0.1  # NP_STREAM_TIMEOUT_US
+HEART_KEY_MS = 1500  # Tecla 2, depois do último quadro do host.
+TEXT_S = 4.3  # Texto depois do fim do coração (~2,5 s).
+
+LUT = neopixel_gamma.table(BRIGHTNESS)
+EXACT = [v for v in range(256) if not (LUT[v] >> (8 - DITHER_BITS)) & ((1 << DITHER_BITS) - 1)]
+
+
+def pixels(k):
+    return bytes(EXACT[(i * 5 + k * 11) % len(EXACT)] for i in range(LEDS * 3))
+
+
+def frame(k):
+    return header(LEDS) + pixels(k)
+
+
+def wire(k, count):
+    # RGB enviado -> GRB na linha, depois da gama; LEDs além do quadro ficam apagados.
+    rgb = pixels(k)
+    out = bytearray(count * 3)
+    for i in range(min(LEDS, count)):
+        r, g, b = rgb[i * 3:i * 3 + 3]
+        out[i * 3:i * 3 + 3] = bytes(((LUT[g] + 128) >> 8, (LUT[r] + 128) >> 8, (LUT[b] + 128) >> 8))
+    return bytes(out)
+
+
+def write_all(fd, data):
+    view = memoryview(data)
+    while view:
+        view = view[os.write(fd, view):]
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("uso: test_stream.py CAMINHO/Animacoes_neopixel_sim", file=sys.stderr)
+        return 2
+
+    with tempfile.TemporaryDirectory() as tmp:
+        trace = os.path.join(tmp, "stream.trace")
+        sim = subprocess.Popen([sys.argv[1], "-p", "-o", trace, "-d", "5500", "2@%d" % HEART_KEY_MS],
+                               stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+        line = sim.stderr.readline()
+        if not line.startswith("sim: pty "):
+            print("test_stream: o simulador não abriu o pseudoterminal: " + line.strip(), file=sys.stderr)
+            sim.kill()
+            return 1
+        start = time.monotonic()
+        fd = os.open(line.split()[2], os.O_WRONLY | os.O_NOCTTY)
+        tty.setraw(fd)
+
+        time.sleep(0.2)
+        write_all(fd, frame(1))
+        time.sleep(0.02)
+
+        # Soma errada: 25 pixels descartados, com um cabeçalho válido e "\n" no meio.
+        hi, lo = (LEDS - 1) >> 8, (LEDS - 1) & 0xFF
+        bad = bytes((ord("A"), ord("d"), ord("a"), hi, lo, hi ^ lo ^ 0x54))
+        skipped = bytearray(pixels(2))
+        skipped[10:10 + 6] = header(LEDS)
+        skipped[30] = ord("\n")
+        write_all(fd, bad + skipped)
+        write_all(fd, frame(3))
+        time.sleep(3 * TIMEOUT_S)
+
+        # Truncado: metade do quadro, uma pausa além do tempo limite e outro quadro.
+        write_all(fd, frame(4)[:6 + LEDS * 3 // 2])
+        time.sleep(3 * TIMEOUT_S)
+        write_all(fd, frame(5))
+        time.sleep(0.02)
+
+        # Texto durante a transmissão: descartado.
+        write_all(fd, b"oi mundo\n")
+        time.sleep(0.02)
+        write_all(fd, frame(6))
+
+        # Texto depois da transmissão e do coração (começando como um cabeçalho): o letreiro.
+        time.sleep(max(0, TEXT_S - (time.monotonic() - start)))
+        write_all(fd, b"Adx\n")
+
+        sim.communicate(timeout=30)
+        os.close(fd)
+        with open(trace) as f:
+            lines = [ln.split() for ln in f if ln.strip()]
+
+    shown = [(int(us), bytes.fromhex(data)) for us, pin, data in lines if int(pin) == LED_PIN]
+    if not shown:
+        print("test_stream: nenhum quadro no trace", file=sys.stderr)
+        return 1
+    count = len(shown[0][1]) // 3
+
+    # O quadro apagado do início, os quadros do host, o coração e depois o letreiro.
+    while shown and not any(shown[0][1]):
+        shown.pop(0)
+    expected = [1, 3, 5, 6]
+    ok = True
+    for i, k in enumerate(expected):
+        got = shown[i][1] if i < len(shown) else None
+        if got != wire(k, count):
+            print(f"test_stream: quadro {i} nos LEDs: {got.hex() if got else 'nenhum'}, "
+                  f"esperado o quadro {k} enviado: {wire(k, count).hex()}", file=sys.stderr)
+            ok = False
+    rest = shown[len(expected):]
+    if ok and (not rest or rest[0][0] < HEART_KEY_MS * 1000):
+        print("test_stream: quadro a mais depois do último quadro do host, antes da tecla 2: " +
+              (rest[0][1].hex() if rest else "nenhum quadro do coração"), file=sys.stderr)
+        ok = False
+    if ok:
+        # Primeiro quadro do coração: o último do host com um LED vermelho a mais (pontilhado:
+        # o vermelho é um dos dois passos em volta do valor da tabela).
+        last, heart = wire(6, count), rest[0][1]
+        diff = [i for i in range(count) if heart[i * 3:i * 3 + 3] != last[i * 3:i * 3 + 3]]
+        reds = (bytes((0, LUT[255] >> 8, 0)), bytes((0, (LUT[255] >> 8) + 1, 0)))
+        if len(diff) != 1 or heart[diff[0] * 3:diff[0] * 3 + 3] not in reds:
+            print(f"test_stream: primeiro quadro do coração muda os LEDs {diff} do último quadro do host: "
+                  f"{heart.hex()}", file=sys.stderr)
+            ok = False
+    if ok and not any(us >= (TEXT_S - 0.2) * 1e6 for us, _ in rest):
+        print("test_stream: o texto depois da transmissão não chegou ao letreiro", file=sys.stderr)
+        ok = False
+
+    print("test_stream: " + ("ok" if ok else "FALHOU"))
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
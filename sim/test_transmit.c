@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "neopixel.h"
+#include "neopixel_gamma.h"
+#include "neopixel_parallel.h"
+
+/*
+ * Transmissão e travamento dos quadros (neopixel.c e neopixel_parallel.c) sobre a HAL simulada:
+ *   quadro inteiro    bytes na linha (GRB depois da gama), RESET de NP_RESET_US após o último
+ *                     bit, callback de npSetWriteCallback uma vez e npBusy() livre
+ *   quadro igual      nada na linha, callback chamado e npBusy() livre já em npWrite()
+ *   quadro parcial    só até o último pixel que mudou, com o mesmo RESET
+ *   saída paralela    as duas fitas na linha e o RESET após o último bit
+ *
+ * Uso: test_transmit grb8|grb24
+ */
+
+#define TEST_LED_PIN 7
+#define TEST_PAR_PIN 10
+#define TEST_PAR_STRIPS 2
+#define TEST_PIN_MAX 32
+
+// Tempo de bit do WS2812, em ns.
+#define TEST_BIT_NS 1250
+
+static uint8_t wire[TEST_PIN_MAX][LED_COUNT * 3];
+static uint64_t wire_end_us[TEST_PIN_MAX];
+static uint wire_frames[TEST_PIN_MAX];
+
+static uint callbacks;
+static uint64_t callback_us;
+static uint failures;
+
+static void on_frame(unsigned int pin, const uint8_t *bytes, size_t len, uint64_t t_ns)
+{
+    if (pin >= TEST_PIN_MAX)
+        return;
+    memcpy(wire[pin], bytes, len < sizeof(wire[pin]) ? len : sizeof(wire[pin]));
+    wire_end_us[pin] = t_ns / 1000;
+    wire_frames[pin]++;
+}
+
+static void on_latch(void)
+{
+    callbacks++;
+    callback_us = time_us_64();
+}
+
+static void check(bool ok, const char *caso, const char *msg, long long valor, long long esperado)
+{
+    if (ok)
+        return;
+    fprintf(stderr, "%s: %s: %lld, esperado %lld\n", caso, msg, valor, esperado);
+    failures++;
+}
+
+// Confere os bytes de um pino contra as cores (0xGGRRBB00) depois da gama.
+static void check_wire(const char *caso, uint pin, const npColor_t *cores, uint n)
+{
+    for (uint i = 0; i < n; i++)
+    {
+        uint8_t g = np_lut8(np_lut, cores[i] >> 24), r = np_lut8(np_lut, cores[i] >> 16),
+                b = np_lut8(np_lut, cores[i] >> 8);
+        const uint8_t *w = wire[pin] + i * 3;
+        if (w[0] != g || w[1] != r || w[2] != b)
+        {
+            fprintf(stderr, "%s: LED %u: GRB %02x%02x%02x, esperado %02x%02x%02x\n", caso, i, w[0], w[1], w[2], g, r, b);
+            failures++;
+            return;
+        }
+    }
+}
+
+static uint64_t tx_bytes(void)
+{
+    uint64_t words, bytes;
+    sim_pio_tx_counters(&words, &bytes);
+    return bytes;
+}
+
+// Apresenta o quadro de trás, espera o travamento e confere linha, RESET e callback.
+static void check_frame(const char *caso, uint pixels)
+{
+    npColor_t cores[LED_COUNT];
+    memcpy(cores, leds, sizeof(cores));
+    uint callbacks0 = callbacks, frames0 = wire_frames[TEST_LED_PIN];
+    uint64_t bytes0 = tx_bytes();
+    uint64_t t0 = time_us_64();
+
+    npWrite();
+    check(npBusy(), caso, "npBusy() logo após npWrite()", npBusy(), 1);
+    npWait();
+    sim_pio_flush(true);
+
+    int64_t tx_us = wire_end_us[TEST_LED_PIN] - t0;
+    int64_t reset_us = callback_us - wire_end_us[TEST_LED_PIN];
+    int64_t expected_tx_us = (int64_t)pixels * 24 * TEST_BIT_NS / 1000;
+    check(wire_frames[TEST_LED_PIN] == frames0 + 1, caso, "quadros travados", wire_frames[TEST_LED_PIN] - frames0, 1);
+    check(callbacks == callbacks0 + 1, caso, "callbacks", callbacks - callbacks0, 1);
+    check(tx_bytes() - bytes0 == pixels * 3, caso, "bytes na linha", tx_bytes() - bytes0, pixels * 3);
+    check(tx_us >= expected_tx_us && tx_us <= expected_tx_us + NP_DRAIN_POLL_US, caso,
+          "us de npWrite() ao último bit", tx_us, expected_tx_us);
+    check(reset_us >= NP_RESET_US && reset_us <= NP_RESET_US + NP_DRAIN_POLL_US, caso,
+          "us do último bit ao callback", reset_us, NP_RESET_US);
+    check(!npBusy(), caso, "npBusy() após o callback", npBusy(), 0);
+    check_wire(caso, TEST_LED_PIN, cores, LED_COUNT);
+}
+
+static void test_full(void)
+{
+    for (uint i = 0; i < LED_COUNT; i++)
+        npSetLED(i, 255 - i * 7, i * 9, 64 + i);
+    check_frame("quadro inteiro", LED_COUNT);
+}
+
+static void test_unchanged(void)
+{
+    const char *caso = "quadro igual";
+    uint callbacks0 = callbacks, frames0 = wire_frames[TEST_LED_PIN];
+    uint64_t bytes0 = tx_bytes();
+
+    npWrite();
+    check(!npBusy(), caso, "npBusy() logo após npWrite()", npBusy(), 0);
+    check(callbacks == callbacks0 + 1, caso, "callbacks", callbacks - callbacks0, 1);
+    sleep_ms(1);
+    sim_pio_flush(true);
+    check(wire_frames[TEST_LED_PIN] == frames0, caso, "quadros travados", wire_frames[TEST_LED_PIN] - frames0, 0);
+    check(tx_bytes() == bytes0, caso, "bytes na linha", tx_bytes() - bytes0, 0);
+}
+
+static void test_partial(void)
+{
+    const uint changed = LED_COUNT / 3;
+    npSetLED(changed, 1, 2, 3);
+    check_frame("quadro parcial", changed + 1);
+}
+
+static void test_parallel(void)
+{
+    const char *caso = "saída paralela";
+    npColor_t cores[TEST_PAR_STRIPS][NP_PAR_LEDS_PER_STRIP];
+
+    npParInit(TEST_PAR_PIN, TEST_PAR_STRIPS);
+    for (uint s = 0; s < TEST_PAR_STRIPS; s++)
+        for (uint i = 0; i < NP_PAR_LEDS_PER_STRIP; i++)
+        {
+            cores[s][i] = NP_COLOR(i * 10, s ? 255 : 0, 200 - i);
+            npParSetLED(s, i, cores[s][i] >> 16, cores[s][i] >> 24, cores[s][i] >> 8);
+        }
+
+    uint64_t t0 = time_us_64();
+    npParWrite();
+    check(npParBusy(), caso, "npParBusy() logo após npParWrite()", npParBusy(), 1);
+    npParWait();
+    int64_t latch_us = time_us_64() - t0;
+    sim_pio_flush(true);
+
+    int64_t expected_tx_us = (int64_t)NP_PAR_LEDS_PER_STRIP * 24 * TEST_BIT_NS / 1000;
+    int64_t reset_us = time_us_64() - wire_end_us[TEST_PAR_PIN];
+    check(latch_us >= expected_tx_us + NP_RESET_US && latch_us <= expected_tx_us + NP_RESET_US + NP_DRAIN_POLL_US,
+          caso, "us de npParWrite() ao travamento", latch_us, expected_tx_us + NP_RESET_US);
+    check(reset_us >= NP_RESET_US && reset_us <= NP_RESET_US + NP_DRAIN_POLL_US, caso,
+          "us do último bit ao travamento", reset_us, NP_RESET_US);
+    for (uint s = 0; s < TEST_PAR_STRIPS; s++)
+    {
+        check(wire_frames[TEST_PAR_PIN + s] == 1, caso, "quadros travados na fita", wire_frames[TEST_PAR_PIN + s], 1);
+        check_wire(caso, TEST_PAR_PIN + s, cores[s], NP_PAR_LEDS_PER_STRIP);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    np_mode_t mode;
+    if (argc == 2 && strcmp(argv[1], "grb8") == 0)
+        mode = NP_MODE_GRB8;
+    else if (argc == 2 && strcmp(argv[1], "grb24") == 0)
+        mode = NP_MODE_GRB24;
+    else
+    {
+        fprintf(stderr, "uso: %s grb8|grb24\n", argv[0]);
+        return 2;
+    }
+
+    sim_set_frame_hook(on_frame);
+    npInitMode(TEST_LED_PIN, mode);
+    npSetWriteCallback(on_latch);
+
+    test_full();
+    test_unchanged();
+    test_partial();
+    test_parallel();
+
+    printf("%s: %s\n", argv[1], failures ? "FALHOU" : "ok");
+    return failures ? 1 : 0;
+}